@@ -1,4 +1,17 @@
 #include "AbletonImporter.h"
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <set>
+
+namespace
+{
+    constexpr int kNumCopyThreads = 2;
+    constexpr size_t kCopyQueueCapacity = 64;
+    constexpr juce::int64 kCopyBlockSize = 1 << 20;
+}
 
 static juce::File getImportLogFile()
 {
@@ -8,6 +21,8 @@ static juce::File getImportLogFile()
 
 static void logImport (const juce::String& msg)
 {
+    static std::mutex logMutex;
+    std::lock_guard<std::mutex> lock (logMutex);
     getImportLogFile().appendText (msg + "\n");
 }
 
@@ -80,154 +95,463 @@ juce::String AbletonImporter::computeRelativeSamplePath (const juce::String& abs
     return juce::File (absoluteSamplePath).getFileName();
 }
 
-AbletonImporter::ImportResult AbletonImporter::importFromDirectory (
-    const juce::File& adgSourceDir,
-    const juce::File& samplesDir,
-    const juce::File& presetsDir,
-    AdgParser& parser,
-    std::function<void (float progress, const juce::String& status)> onProgress)
+//==============================================================================
+// Parse workers pull .adg files off a shared counter and hand every sample that
+// still needs copying to a bounded queue, blocking while it is full so parsing
+// can't run arbitrarily far ahead of the disk. A kit's .dkit is written by
+// whichever thread finishes its last copy, so a cancelled import never leaves
+// a preset behind that points at samples which were not copied yet.
+class AbletonImporter::Pipeline
 {
-    juce::Array<juce::File> dirs;
-    dirs.add (adgSourceDir);
-    return importFromDirectories (dirs, samplesDir, presetsDir, parser, onProgress);
-}
+public:
+    Pipeline (const juce::Array<juce::File>& files, const juce::File& samples,
+              const juce::File& presets, const AdgParser& adgParser)
+        : adgFiles (files), samplesDir (samples), presetsDir (presets), parser (adgParser),
+          abletonCoreLib (adgParser.getAbletonLibraryPath())
+    {
+    }
 
-AbletonImporter::ImportResult AbletonImporter::importFromDirectories (
-    const juce::Array<juce::File>& adgSourceDirs,
-    const juce::File& samplesDir,
-    const juce::File& presetsDir,
-    AdgParser& parser,
-    std::function<void (float progress, const juce::String& status)> onProgress)
-{
-    ImportResult result;
+    ImportResult run (const ProgressCallback& onProgress, const CancelCheck& shouldCancel)
+    {
+        const int numParsers = juce::jlimit (1, 8, juce::SystemStats::getNumCpus() - 1);
+        activeParsers = numParsers;
+        activeWorkers = numParsers + kNumCopyThreads;
 
-    samplesDir.createDirectory();
-    presetsDir.createDirectory();
+        {
+            juce::ThreadPool pool (juce::ThreadPoolOptions{}
+                                       .withThreadName ("Beatwerk import")
+                                       .withNumberOfThreads (activeWorkers));
 
-    auto logFile = getImportLogFile();
-    logFile.replaceWithText ("=== Ableton Import " + juce::Time::getCurrentTime().toISO8601 (true) + " ===\n");
-    logImport ("Samples dir: " + samplesDir.getFullPathName());
-    logImport ("Presets dir: " + presetsDir.getFullPathName());
+            for (int i = 0; i < numParsers; ++i)
+                pool.addJob ([this] { parseWorker(); });
 
-    auto abletonCoreLib = parser.getAbletonLibraryPath();
-    logImport ("Ableton Core Library: " + abletonCoreLib.getFullPathName());
+            for (int i = 0; i < kNumCopyThreads; ++i)
+                pool.addJob ([this] { copyWorker(); });
 
-    juce::Array<juce::File> adgFiles;
-    for (auto& dir : adgSourceDirs)
+            for (;;)
+            {
+                {
+                    std::unique_lock<std::mutex> lock (queueMutex);
+                    if (workersFinished.wait_for (lock, std::chrono::milliseconds (100),
+                                                  [this] { return activeWorkers == 0; }))
+                        break;
+                }
+
+                if (! cancelled && shouldCancel != nullptr && shouldCancel())
+                    cancel();
+
+                if (onProgress)
+                    onProgress (getProgress());
+            }
+        }
+
+        std::lock_guard<std::mutex> lock (mutex);
+        result.cancelled = cancelled;
+        return result;
+    }
+
+    Progress getProgress()
     {
-        if (dir.isDirectory())
+        Progress progress;
+        progress.kitsDone = kitsDone;
+        progress.kitsTotal = adgFiles.size();
+        progress.bytesCopied = bytesCopied;
+        progress.bytesQueued = bytesQueued;
+
+        std::lock_guard<std::mutex> lock (mutex);
+        progress.currentKit = currentKit;
+        return progress;
+    }
+
+private:
+    struct Kit
+    {
+        juce::File dkitFile;
+        DkitPreset preset;
+        std::atomic<int> pendingCopies { 1 };   // starts at one so the kit can't complete mid-parse
+    };
+
+    using KitPtr = std::shared_ptr<Kit>;
+
+    struct Copy
+    {
+        juce::File source, dest;
+        juce::int64 size = 0;
+        bool done = false;
+        std::vector<KitPtr> waitingKits;
+    };
+
+    using CopyPtr = std::shared_ptr<Copy>;
+
+    //==============================================================================
+    void parseWorker()
+    {
+        for (;;)
         {
-            logImport ("Scanning: " + dir.getFullPathName());
-            auto found = dir.findChildFiles (juce::File::findFiles, true, "*.adg");
-            logImport ("  Found " + juce::String (found.size()) + " .adg files");
-            adgFiles.addArray (found);
+            const int index = nextFile++;
+            if (cancelled || index >= adgFiles.size())
+                break;
+
+            parseKit (adgFiles.getReference (index));
         }
-    }
 
-    logImport ("Total .adg files: " + juce::String (adgFiles.size()));
+        std::lock_guard<std::mutex> lock (queueMutex);
+        if (--activeParsers == 0)
+            queueNotEmpty.notify_all();
 
-    if (adgFiles.isEmpty())
-        return result;
+        if (--activeWorkers == 0)
+            workersFinished.notify_all();
+    }
 
-    for (int i = 0; i < adgFiles.size(); ++i)
+    void parseKit (const juce::File& adgFile)
     {
-        auto adgFile = adgFiles[i];
         auto kitName = adgFile.getFileNameWithoutExtension();
+        auto dkitFile = presetsDir.getChildFile (kitName + ".dkit");
+
+        bool alreadyExists = false;
 
-        if (onProgress)
         {
-            float progress = (float) i / (float) adgFiles.size();
-            onProgress (progress, "Importing: " + kitName);
+            std::lock_guard<std::mutex> lock (mutex);
+            currentKit = kitName;
+
+            // Kits with the same name in two source folders write the same .dkit,
+            // so only the first one to get here is imported
+            if (! claimedNames.insert (kitName.toLowerCase()).second || dkitFile.existsAsFile())
+            {
+                result.skippedExisting++;
+                ++kitsDone;
+                alreadyExists = true;
+            }
         }
 
-        auto dkitFile = presetsDir.getChildFile (kitName + ".dkit");
-        if (dkitFile.existsAsFile())
+        // Logged outside the lock, so the other workers don't wait on the file
+        if (alreadyExists)
         {
-            result.skippedExisting++;
             logImport ("[SKIP-EXISTS] " + kitName);
-            continue;
+            return;
         }
 
         auto adgKit = parser.parseFile (adgFile);
+        if (cancelled)
+            return;
 
         if (adgKit.mappings.empty())
         {
-            result.skippedNoSamples++;
-            result.skippedNames.add (kitName);
+            {
+                std::lock_guard<std::mutex> lock (mutex);
+                result.skippedNoSamples++;
+                result.skippedNames.add (kitName);
+                ++kitsDone;
+            }
+
             logImport ("[SKIP-NO-SAMPLES] " + kitName + " (" + adgFile.getFullPathName() + ")");
-            continue;
+            return;
         }
 
-        logImport ("[IMPORT] " + kitName + " - " + juce::String ((int) adgKit.mappings.size()) + " mappings");
+        juce::StringArray log;
+        log.add ("[IMPORT] " + kitName + " - " + juce::String ((int) adgKit.mappings.size()) + " mappings");
 
-        DkitPreset preset;
-        preset.name = adgKit.kitName;
-        preset.source = "Imported from Ableton Live";
-        preset.createdAt = juce::Time::getCurrentTime().toISO8601 (true);
+        auto kit = std::make_shared<Kit>();
+        kit->dkitFile = dkitFile;
+        kit->preset.name = adgKit.kitName;
+        kit->preset.source = "Imported from Ableton Live";
+        kit->preset.createdAt = juce::Time::getCurrentTime().toISO8601 (true);
 
         int missingSamplesInKit = 0;
 
         for (auto& mapping : adgKit.mappings)
         {
+            DkitPadMapping pad;
+            pad.midiNote = mapping.midiNote;
+            pad.sampleFile = computeRelativeSamplePath (mapping.samplePath, abletonCoreLib);
+            pad.sampleName = mapping.sampleName;
+            kit->preset.pads.push_back (pad);
+
             juce::File srcSample (mapping.samplePath);
 
             if (! srcSample.existsAsFile())
             {
                 missingSamplesInKit++;
-                logImport ("  [MISSING] note=" + juce::String (mapping.midiNote)
-                           + " path=" + mapping.samplePath);
-
-                DkitPadMapping pad;
-                pad.midiNote = mapping.midiNote;
-                pad.sampleFile = computeRelativeSamplePath (mapping.samplePath, abletonCoreLib);
-                pad.sampleName = mapping.sampleName;
-                preset.pads.push_back (pad);
+                log.add ("  [MISSING] note=" + juce::String (mapping.midiNote)
+                         + " path=" + mapping.samplePath);
                 continue;
             }
 
-            auto relativePath = computeRelativeSamplePath (mapping.samplePath, abletonCoreLib);
-            auto destSample = samplesDir.getChildFile (relativePath);
+            if (! requestCopy (kit, srcSample, samplesDir.getChildFile (pad.sampleFile)))
+                return;
+        }
+
+        if (missingSamplesInKit > 0)
+            log.add ("  " + juce::String (missingSamplesInKit) + " missing samples in this kit");
+
+        logImport (log.joinIntoString ("\n"));
+        releaseKit (kit);
+    }
+
+    // Queues a copy unless the destination already exists or another kit has
+    // already queued it, in which case the kit waits for that copy instead.
+    // Returns false once the import has been cancelled.
+    bool requestCopy (const KitPtr& kit, const juce::File& source, const juce::File& dest)
+    {
+        auto copy = std::make_shared<Copy>();
 
-            if (! destSample.existsAsFile())
+        {
+            std::lock_guard<std::mutex> lock (mutex);
+            auto key = dest.getFullPathName();
+
+            if (auto it = copies.find (key); it != copies.end())
             {
-                destSample.getParentDirectory().createDirectory();
-                if (srcSample.copyFileTo (destSample))
-                {
-                    result.samplesCopied++;
-                }
-                else
+                if (! it->second->done)
                 {
-                    result.errors++;
-                    result.errorMessages.add ("Failed to copy: " + srcSample.getFileName());
-                    logImport ("  [COPY-FAIL] " + srcSample.getFullPathName()
-                               + " -> " + destSample.getFullPathName());
+                    ++kit->pendingCopies;
+                    it->second->waitingKits.push_back (kit);
                 }
+
+                return ! cancelled;
             }
 
-            DkitPadMapping pad;
-            pad.midiNote = mapping.midiNote;
-            pad.sampleFile = relativePath;
-            pad.sampleName = mapping.sampleName;
-            preset.pads.push_back (pad);
+            if (dest.existsAsFile())
+                return ! cancelled;
+
+            copy->source = source;
+            copy->dest = dest;
+            copy->size = source.getSize();
+            copy->waitingKits.push_back (kit);
+            ++kit->pendingCopies;
+            copies[key] = copy;
         }
 
-        if (missingSamplesInKit > 0)
-            logImport ("  " + juce::String (missingSamplesInKit) + " missing samples in this kit");
+        bytesQueued += copy->size;
+
+        std::unique_lock<std::mutex> lock (queueMutex);
+        queueNotFull.wait (lock, [this] { return cancelled || copyQueue.size() < kCopyQueueCapacity; });
+
+        if (cancelled)
+            return false;
 
-        if (PresetManager::writeDkitJson (dkitFile, preset))
+        copyQueue.push_back (copy);
+        queueNotEmpty.notify_one();
+        return true;
+    }
+
+    //==============================================================================
+    void copyWorker()
+    {
+        while (auto copy = popCopy())
         {
-            result.presetsImported++;
-            logImport ("  -> Written: " + dkitFile.getFileName());
+            juce::int64 copied = 0;
+            const bool ok = copySample (*copy, copied);
+
+            if (cancelled)
+                break;
+
+            // Count the whole file even if it failed or changed size since it was queued
+            bytesCopied += copy->size - copied;
+            copyFinished (copy, ok);
         }
+
+        std::lock_guard<std::mutex> lock (queueMutex);
+        if (--activeWorkers == 0)
+            workersFinished.notify_all();
+    }
+
+    CopyPtr popCopy()
+    {
+        std::unique_lock<std::mutex> lock (queueMutex);
+        queueNotEmpty.wait (lock, [this] { return cancelled || ! copyQueue.empty() || activeParsers == 0; });
+
+        if (cancelled || copyQueue.empty())
+            return nullptr;
+
+        auto copy = copyQueue.front();
+        copyQueue.pop_front();
+        queueNotFull.notify_one();
+        return copy;
+    }
+
+    // Copies through a temporary file so a cancelled or failed copy never
+    // leaves a truncated sample that the next import would take as present
+    bool copySample (const Copy& copy, juce::int64& copied)
+    {
+        if (! copy.dest.getParentDirectory().createDirectory())
+            return false;
+
+        juce::TemporaryFile temp (copy.dest);
+
+        {
+            juce::FileInputStream in (copy.source);
+            juce::FileOutputStream out (temp.getFile());
+            if (! in.openedOk() || ! out.openedOk())
+                return false;
+
+            while (! in.isExhausted())
+            {
+                if (cancelled)
+                    return false;
+
+                auto written = out.writeFromInputStream (in, kCopyBlockSize);
+                if (written <= 0)
+                    return false;
+
+                copied += written;
+                bytesCopied += written;
+            }
+
+            out.flush();
+            if (out.getStatus().failed())
+                return false;
+        }
+
+        return temp.overwriteTargetFileWithTemporary();
+    }
+
+    void copyFinished (const CopyPtr& copy, bool ok)
+    {
+        std::vector<KitPtr> kits;
+
+        {
+            std::lock_guard<std::mutex> lock (mutex);
+            copy->done = true;
+            kits.swap (copy->waitingKits);
+
+            if (ok)
+            {
+                result.samplesCopied++;
+            }
+            else
+            {
+                result.errors++;
+                result.errorMessages.add ("Failed to copy: " + copy->source.getFileName());
+            }
+        }
+
+        if (! ok)
+            logImport ("  [COPY-FAIL] " + copy->source.getFullPathName()
+                       + " -> " + copy->dest.getFullPathName());
+
+        for (auto& kit : kits)
+            releaseKit (kit);
+    }
+
+    //==============================================================================
+    void releaseKit (const KitPtr& kit)
+    {
+        if (--kit->pendingCopies > 0 || cancelled)
+            return;
+
+        const bool written = PresetManager::writeDkitJson (kit->dkitFile, kit->preset);
+
+        {
+            std::lock_guard<std::mutex> lock (mutex);
+            ++kitsDone;
+
+            if (written)
+            {
+                result.presetsImported++;
+            }
+            else
+            {
+                result.errors++;
+                result.errorMessages.add ("Failed to write: " + kit->dkitFile.getFileName());
+            }
+        }
+
+        if (written)
+            logImport ("  -> Written: " + kit->dkitFile.getFileName());
         else
+            logImport ("  [WRITE-FAIL] " + kit->dkitFile.getFullPathName());
+    }
+
+    void cancel()
+    {
         {
-            result.errors++;
-            result.errorMessages.add ("Failed to write: " + dkitFile.getFileName());
-            logImport ("  [WRITE-FAIL] " + dkitFile.getFullPathName());
+            std::lock_guard<std::mutex> lock (queueMutex);
+            cancelled = true;
         }
+
+        queueNotFull.notify_all();
+        queueNotEmpty.notify_all();
     }
 
+    //==============================================================================
+    const juce::Array<juce::File>& adgFiles;
+    const juce::File samplesDir, presetsDir;
+    const AdgParser& parser;
+    const juce::File abletonCoreLib;
+
+    std::atomic<int> nextFile { 0 };
+    std::atomic<int> kitsDone { 0 };
+    std::atomic<juce::int64> bytesCopied { 0 }, bytesQueued { 0 };
+    std::atomic<bool> cancelled { false };
+
+    // Guards result, copies, claimedNames and currentKit
+    std::mutex mutex;
+    ImportResult result;
+    std::map<juce::String, CopyPtr> copies;
+    std::set<juce::String> claimedNames;
+    juce::String currentKit;
+
+    std::mutex queueMutex;
+    std::condition_variable queueNotFull, queueNotEmpty, workersFinished;
+    std::deque<CopyPtr> copyQueue;
+    int activeParsers = 0, activeWorkers = 0;
+};
+
+//==============================================================================
+AbletonImporter::ImportResult AbletonImporter::importFromDirectory (
+    const juce::File& adgSourceDir,
+    const juce::File& samplesDir,
+    const juce::File& presetsDir,
+    AdgParser& parser,
+    ProgressCallback onProgress,
+    CancelCheck shouldCancel)
+{
+    juce::Array<juce::File> dirs;
+    dirs.add (adgSourceDir);
+    return importFromDirectories (dirs, samplesDir, presetsDir, parser, onProgress, shouldCancel);
+}
+
+AbletonImporter::ImportResult AbletonImporter::importFromDirectories (
+    const juce::Array<juce::File>& adgSourceDirs,
+    const juce::File& samplesDir,
+    const juce::File& presetsDir,
+    AdgParser& parser,
+    ProgressCallback onProgress,
+    CancelCheck shouldCancel)
+{
+    samplesDir.createDirectory();
+    presetsDir.createDirectory();
+
+    auto logFile = getImportLogFile();
+    logFile.replaceWithText ("=== Ableton Import " + juce::Time::getCurrentTime().toISO8601 (true) + " ===\n");
+    logImport ("Samples dir: " + samplesDir.getFullPathName());
+    logImport ("Presets dir: " + presetsDir.getFullPathName());
+    logImport ("Ableton Core Library: " + parser.getAbletonLibraryPath().getFullPathName());
+
+    juce::Array<juce::File> adgFiles;
+    for (auto& dir : adgSourceDirs)
+    {
+        if (dir.isDirectory())
+        {
+            logImport ("Scanning: " + dir.getFullPathName());
+            auto found = dir.findChildFiles (juce::File::findFiles, true, "*.adg");
+            logImport ("  Found " + juce::String (found.size()) + " .adg files");
+            adgFiles.addArray (found);
+        }
+    }
+
+    logImport ("Total .adg files: " + juce::String (adgFiles.size()));
+
+    if (adgFiles.isEmpty())
+        return {};
+
+    Pipeline pipeline (adgFiles, samplesDir, presetsDir, parser);
+    auto result = pipeline.run (onProgress, shouldCancel);
+
     logImport ("\n=== Summary ===");
+    if (result.cancelled)
+        logImport ("Cancelled after " + juce::String (pipeline.getProgress().kitsDone)
+                   + " of " + juce::String (adgFiles.size()) + " kits");
     logImport ("Imported: " + juce::String (result.presetsImported));
     logImport ("Samples copied: " + juce::String (result.samplesCopied));
     logImport ("Skipped (no audio samples): " + juce::String (result.skippedNoSamples));
@@ -235,7 +559,7 @@ AbletonImporter::ImportResult AbletonImporter::importFromDirectories (
     logImport ("Errors: " + juce::String (result.errors));
 
     if (onProgress)
-        onProgress (1.0f, "Import complete");
+        onProgress (pipeline.getProgress());
 
     return result;
 }
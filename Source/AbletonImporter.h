@@ -14,27 +14,49 @@ public:
         int skippedNoSamples = 0;
         int skippedExisting = 0;
         int errors = 0;
+        bool cancelled = false;
         juce::StringArray errorMessages;
         juce::StringArray skippedNames;
     };
 
+    struct Progress
+    {
+        int kitsDone = 0;
+        int kitsTotal = 0;
+        juce::int64 bytesCopied = 0;
+        juce::int64 bytesQueued = 0;    // grows as parsed kits discover samples to copy
+        juce::String currentKit;
+
+        float getFraction() const { return kitsTotal > 0 ? (float) kitsDone / (float) kitsTotal : 0.0f; }
+    };
+
+    using ProgressCallback = std::function<void (const Progress&)>;
+    using CancelCheck = std::function<bool()>;
+
+    // Parses kits on a pool of workers and copies their samples through a
+    // bounded queue. Blocks the calling thread, which polls shouldCancel and
+    // calls onProgress a few times a second until the import is done.
     static ImportResult importFromDirectories (
         const juce::Array<juce::File>& adgSourceDirs,
         const juce::File& samplesDir,
         const juce::File& presetsDir,
         AdgParser& parser,
-        std::function<void (float progress, const juce::String& status)> onProgress = nullptr);
+        ProgressCallback onProgress = nullptr,
+        CancelCheck shouldCancel = nullptr);
 
     static ImportResult importFromDirectory (
         const juce::File& adgSourceDir,
         const juce::File& samplesDir,
         const juce::File& presetsDir,
         AdgParser& parser,
-        std::function<void (float progress, const juce::String& status)> onProgress = nullptr);
+        ProgressCallback onProgress = nullptr,
+        CancelCheck shouldCancel = nullptr);
 
     static juce::Array<juce::File> findAbletonPresetDirs();
 
 private:
+    class Pipeline;
+
     static juce::String computeRelativeSamplePath (const juce::String& absoluteSamplePath,
                                                     const juce::File& abletonCoreLib);
 };
@@ -1,14 +1,6 @@
 #include "AdgParser.h"
 #include <juce_audio_formats/juce_audio_formats.h>
 #include <algorithm>
-#include <fstream>
-
-static void logToFile (const juce::String& msg)
-{
-    auto logFile = juce::File::getSpecialLocation (juce::File::userDesktopDirectory)
-                       .getChildFile ("mps_drum_debug.log");
-    logFile.appendText ("[AdgParser] " + msg + "\n");
-}
 
 AdgParser::AdgParser()
 {
@@ -45,10 +37,7 @@ AdgDrumKit AdgParser::parseFile (const juce::File& adgFile) const
 
     juce::FileInputStream fileStream (adgFile);
     if (fileStream.failedToOpen())
-    {
-        logToFile ("AdgParser: failed to open file: " + adgFile.getFullPathName());
         return kit;
-    }
 
     juce::GZIPDecompressorInputStream gzipStream (&fileStream, false,
                                                   juce::GZIPDecompressorInputStream::gzipFormat);
@@ -57,22 +46,12 @@ AdgDrumKit AdgParser::parseFile (const juce::File& adgFile) const
     memStream.writeFromInputStream (gzipStream, -1);
     auto xmlContent = memStream.toString();
 
-    logToFile ("AdgParser: decompressed " + juce::String ((int) xmlContent.length()) + " bytes from " + adgFile.getFileName());
-
     if (xmlContent.isEmpty())
-    {
-        logToFile ("AdgParser: XML content is empty!");
         return kit;
-    }
 
     auto xml = juce::XmlDocument::parse (xmlContent);
     if (xml == nullptr)
-    {
-        logToFile ("AdgParser: XML parse failed!");
         return kit;
-    }
-
-    logToFile ("AdgParser: root tag = " + xml->getTagName());
 
     // Ableton 12 drum rack .adg structure:
     // Ableton > GroupDevicePreset > BranchPresets > DrumBranchPreset[]
@@ -95,7 +74,6 @@ AdgDrumKit AdgParser::parseFile (const juce::File& adgFile) const
 
         if (el->getTagName() == "DrumBranchPreset")
         {
-            logToFile ("AdgParser: found DrumBranchPreset");
             parseBranch (el, kit.mappings);
             return;
         }
@@ -106,8 +84,6 @@ AdgDrumKit AdgParser::parseFile (const juce::File& adgFile) const
 
     findDrumBranches (xml.get());
 
-    logToFile ("AdgParser: found " + juce::String ((int) kit.mappings.size()) + " sample mappings");
-
     // Remap Ableton drum kit samples to MPS-1000 pads using filename-based matching.
     // Ableton kits use internal notes (77-92) that don't match the MPS-1000 (21-59).
     // We try to match by drum type keywords in sample filenames.
@@ -223,7 +199,6 @@ void AdgParser::parseBranch (juce::XmlElement* branch, std::vector<AdgSampleMapp
 
     // Find sample file path
     juce::String samplePath = findSamplePath (branch);
-    logToFile ("AdgParser: branch note=" + juce::String (midiNote) + " samplePath=" + samplePath);
 
     if (samplePath.isEmpty())
         return;
@@ -233,9 +208,6 @@ void AdgParser::parseBranch (juce::XmlElement* branch, std::vector<AdgSampleMapp
     mapping.samplePath = samplePath;
     mapping.sampleName = juce::File (samplePath).getFileNameWithoutExtension();
 
-    logToFile ("AdgParser: mapped note " + juce::String (midiNote) + " -> " + mapping.sampleName
-         + " (exists: " + juce::String (juce::File (samplePath).existsAsFile() ? "YES" : "NO") + ")");
-
     mappings.push_back (mapping);
 }
 
@@ -0,0 +1,140 @@
+#include "DirectoryLister.h"
+#include "SampleIndex.h"
+#include <algorithm>
+
+DirectoryLister::DirectoryLister()
+    : juce::Thread ("Beatwerk directory lister")
+{
+    startThread();
+}
+
+DirectoryLister::~DirectoryLister()
+{
+    stopThread (5000);
+}
+
+DirectoryLister::ListingPtr DirectoryLister::getCached (const juce::File& dir)
+{
+    std::lock_guard<std::mutex> lock (mutex);
+
+    auto it = cache.find (dir.getFullPathName());
+    if (it == cache.end())
+        return nullptr;
+
+    it->second.lastUsed = ++useCounter;
+    return it->second.listing;
+}
+
+void DirectoryLister::list (const juce::File& dir, std::function<void (ListingPtr)> onListed)
+{
+    {
+        std::lock_guard<std::mutex> lock (mutex);
+        requests.push_back ({ dir, std::move (onListed) });
+    }
+
+    notify();
+}
+
+void DirectoryLister::forget (const juce::File& dir)
+{
+    std::lock_guard<std::mutex> lock (mutex);
+    cache.erase (dir.getFullPathName());
+}
+
+void DirectoryLister::clear()
+{
+    std::lock_guard<std::mutex> lock (mutex);
+    cache.clear();
+}
+
+//==============================================================================
+void DirectoryLister::run()
+{
+    while (! threadShouldExit())
+    {
+        Request request;
+
+        {
+            std::lock_guard<std::mutex> lock (mutex);
+
+            if (! requests.empty())
+            {
+                request = std::move (requests.front());
+                requests.pop_front();
+            }
+        }
+
+        if (request.onListed == nullptr)
+        {
+            wait (-1);
+            continue;
+        }
+
+        auto modified = request.dir.getLastModificationTime();
+        auto listing = findCurrent (request.dir, modified);
+
+        if (listing == nullptr)
+        {
+            listing = read (request.dir, modified);
+            store (request.dir, listing);
+        }
+
+        juce::MessageManager::callAsync ([onListed = std::move (request.onListed), listing]
+        {
+            onListed (listing);
+        });
+    }
+}
+
+DirectoryLister::ListingPtr DirectoryLister::findCurrent (const juce::File& dir, juce::Time modified)
+{
+    std::lock_guard<std::mutex> lock (mutex);
+
+    auto it = cache.find (dir.getFullPathName());
+    if (it == cache.end() || it->second.listing->modified != modified)
+        return nullptr;
+
+    it->second.lastUsed = ++useCounter;
+    return it->second.listing;
+}
+
+void DirectoryLister::store (const juce::File& dir, ListingPtr listing)
+{
+    std::lock_guard<std::mutex> lock (mutex);
+
+    if (cache.size() >= kMaxCachedDirectories && cache.find (dir.getFullPathName()) == cache.end())
+    {
+        auto oldest = std::min_element (cache.begin(), cache.end(), [] (const auto& a, const auto& b)
+        {
+            return a.second.lastUsed < b.second.lastUsed;
+        });
+
+        cache.erase (oldest);
+    }
+
+    cache[dir.getFullPathName()] = { std::move (listing), ++useCounter };
+}
+
+DirectoryLister::ListingPtr DirectoryLister::read (const juce::File& dir, juce::Time modified)
+{
+    auto listing = std::make_shared<Listing>();
+    listing->modified = modified;
+
+    if (dir.isDirectory())
+    {
+        for (const auto& entry : juce::RangedDirectoryIterator (dir, false, "*",
+                                                                juce::File::findFilesAndDirectories
+                                                                    | juce::File::ignoreHiddenFiles))
+        {
+            if (entry.isDirectory() || SampleIndex::isAudioFile (entry.getFile()))
+                listing->entries.push_back ({ entry.getFile(), entry.isDirectory() });
+        }
+    }
+
+    std::sort (listing->entries.begin(), listing->entries.end(), [] (const Entry& a, const Entry& b)
+    {
+        return a.isFolder != b.isFolder ? a.isFolder : a.file < b.file;
+    });
+
+    return listing;
+}
@@ -0,0 +1,71 @@
+#pragma once
+#include <juce_events/juce_events.h>
+#include <deque>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+// Lists the sample browser's folders on a background thread, and caches
+// each listing with its folder's modification time so that reopening a
+// folder doesn't wait for the disk.
+class DirectoryLister : private juce::Thread
+{
+public:
+    struct Entry
+    {
+        juce::File file;
+        bool isFolder = false;
+    };
+
+    // Subfolders then audio files, each sorted, without hidden files.
+    struct Listing
+    {
+        juce::Time modified;
+        std::vector<Entry> entries;
+    };
+
+    using ListingPtr = std::shared_ptr<const Listing>;
+
+    DirectoryLister();
+    ~DirectoryLister() override;
+
+    // The last listing of dir, which may be out of date, or nullptr.
+    ListingPtr getCached (const juce::File& dir);
+
+    // Re-reads dir unless its cached listing is still current, and passes
+    // the result to onListed on the message thread.
+    void list (const juce::File& dir, std::function<void (ListingPtr)> onListed);
+
+    void forget (const juce::File& dir);
+    void clear();
+
+    static constexpr size_t kMaxCachedDirectories = 1024;
+
+private:
+    struct Request
+    {
+        juce::File dir;
+        std::function<void (ListingPtr)> onListed;
+    };
+
+    struct CacheEntry
+    {
+        ListingPtr listing;
+        juce::uint64 lastUsed = 0;
+    };
+
+    std::mutex mutex;
+    std::deque<Request> requests;
+    std::map<juce::String, CacheEntry> cache;
+    juce::uint64 useCounter = 0;
+
+    void run() override;
+    ListingPtr findCurrent (const juce::File& dir, juce::Time modified);
+    void store (const juce::File& dir, ListingPtr listing);
+
+    static ListingPtr read (const juce::File& dir, juce::Time modified);
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (DirectoryLister)
+};
@@ -0,0 +1,807 @@
+#include "DirectoryWatcher.h"
+#include <algorithm>
+
+#if JUCE_LINUX
+ #include <cerrno>
+ #include <poll.h>
+ #include <sys/inotify.h>
+ #include <unistd.h>
+#elif JUCE_MAC
+ #include <CoreServices/CoreServices.h>
+ #include <dispatch/dispatch.h>
+#elif JUCE_WINDOWS
+ #include <windows.h>
+#endif
+
+namespace
+{
+    constexpr int kTickMs = 100;
+
+    bool isWithin (const juce::File& file, const juce::File& root)
+    {
+        return file == root || file.isAChildOf (root);
+    }
+}
+
+//==============================================================================
+class DirectoryWatcher::Backend
+{
+public:
+    explicit Backend (DirectoryWatcher& w) : watcher (w) {}
+    virtual ~Backend() = default;
+
+    // Waits up to timeoutMs, reporting whatever changed to the watcher
+    virtual void waitForChanges (int timeoutMs) = 0;
+
+protected:
+    DirectoryWatcher& watcher;
+};
+
+#if JUCE_LINUX
+//==============================================================================
+class DirectoryWatcher::InotifyBackend : public Backend
+{
+public:
+    InotifyBackend (DirectoryWatcher& w, const std::vector<juce::File>& rootsToWatch)
+        : Backend (w), roots (rootsToWatch)
+    {
+        fd = inotify_init1 (IN_NONBLOCK | IN_CLOEXEC);
+        if (fd < 0)
+            return;
+
+        for (auto& root : roots)
+        {
+            if (root.isDirectory() && ! addWatchesRecursively (root))
+            {
+                // Out of watches; the caller falls back to polling
+                close (fd);
+                fd = -1;
+                return;
+            }
+        }
+    }
+
+    ~InotifyBackend() override
+    {
+        if (fd >= 0)
+            close (fd);
+    }
+
+    bool isValid() const { return fd >= 0; }
+
+    void waitForChanges (int timeoutMs) override
+    {
+        pollfd pfd { fd, POLLIN, 0 };
+        if (poll (&pfd, 1, timeoutMs) <= 0)
+            return;
+
+        alignas (inotify_event) char buffer[16384];
+
+        for (;;)
+        {
+            auto numRead = read (fd, buffer, sizeof (buffer));
+            if (numRead <= 0)
+                break;
+
+            for (ssize_t offset = 0; offset < numRead;)
+            {
+                auto* event = reinterpret_cast<const inotify_event*> (buffer + offset);
+                handleEvent (*event);
+                offset += (ssize_t) sizeof (inotify_event) + (ssize_t) event->len;
+            }
+        }
+    }
+
+private:
+    static constexpr juce::uint32 kMask = IN_CREATE | IN_DELETE | IN_CLOSE_WRITE | IN_MOVED_FROM | IN_MOVED_TO
+                                        | IN_DELETE_SELF | IN_MOVE_SELF | IN_ONLYDIR | IN_EXCL_UNLINK;
+
+    std::vector<juce::File> roots;
+    int fd = -1;
+    std::map<int, juce::File> watches;  // directory by watch descriptor
+
+    // False only if the system is out of watches
+    bool addWatch (const juce::File& dir)
+    {
+        int wd = inotify_add_watch (fd, dir.getFullPathName().toRawUTF8(), kMask);
+        if (wd < 0)
+            return errno != ENOSPC && errno != ENOMEM;
+
+        watches[wd] = dir;
+        return true;
+    }
+
+    bool addWatchesRecursively (const juce::File& dir)
+    {
+        if (! addWatch (dir))
+            return false;
+
+        for (const auto& entry : juce::RangedDirectoryIterator (dir, true, "*", juce::File::findDirectories))
+            if (! addWatch (entry.getFile()))
+                return false;
+
+        return true;
+    }
+
+    // A directory moved out from under a watched one keeps its watches
+    void removeWatchesUnder (const juce::File& dir)
+    {
+        for (auto it = watches.begin(); it != watches.end();)
+        {
+            if (isWithin (it->second, dir))
+            {
+                inotify_rm_watch (fd, it->first);
+                it = watches.erase (it);
+            }
+            else
+            {
+                ++it;
+            }
+        }
+    }
+
+    void handleEvent (const inotify_event& event)
+    {
+        if ((event.mask & IN_Q_OVERFLOW) != 0)
+        {
+            watcher.reportOverflow ({});
+            return;
+        }
+
+        auto found = watches.find (event.wd);
+        if (found == watches.end())
+            return;
+
+        auto dir = found->second;
+
+        if ((event.mask & IN_IGNORED) != 0)
+        {
+            watches.erase (found);
+            return;
+        }
+
+        // Only matters for a root; anything below is reported by its parent.
+        // A moved root's watches would follow it, so they all get replaced.
+        if ((event.mask & (IN_DELETE_SELF | IN_MOVE_SELF)) != 0)
+        {
+            if (std::find (roots.begin(), roots.end(), dir) != roots.end())
+                watcher.rootLost (dir);
+            return;
+        }
+
+        if (event.len == 0)
+            return;
+
+        Change change;
+        change.file = dir.getChildFile (juce::String::fromUTF8 (event.name));
+        change.isDirectory = (event.mask & IN_ISDIR) != 0;
+
+        if ((event.mask & (IN_CREATE | IN_MOVED_TO)) != 0)
+        {
+            change.type = Change::Type::created;
+
+            // Whatever landed in it before the watch existed is picked up
+            // by the consumer reading the new directory
+            if (change.isDirectory && ! addWatchesRecursively (change.file))
+                watcher.reportOverflow (change.file);
+        }
+        else if ((event.mask & (IN_DELETE | IN_MOVED_FROM)) != 0)
+        {
+            change.type = Change::Type::deleted;
+
+            if (change.isDirectory)
+                removeWatchesUnder (change.file);
+        }
+        else
+        {
+            change.type = Change::Type::modified;
+        }
+
+        watcher.report (change);
+    }
+};
+
+#elif JUCE_MAC
+//==============================================================================
+// One stream covers all roots. Its callbacks run on a dispatch queue, so
+// events are queued there and reported from waitForChanges on the watcher
+// thread.
+class DirectoryWatcher::FSEventsBackend : public Backend
+{
+public:
+    FSEventsBackend (DirectoryWatcher& w, const std::vector<juce::File>& rootsToWatch)
+        : Backend (w)
+    {
+        auto paths = CFArrayCreateMutable (kCFAllocatorDefault, 0, &kCFTypeArrayCallBacks);
+
+        for (auto& root : rootsToWatch)
+        {
+            if (! root.isDirectory())
+                continue;
+
+            auto path = CFStringCreateWithCString (kCFAllocatorDefault, root.getFullPathName().toRawUTF8(),
+                                                   kCFStringEncodingUTF8);
+            CFArrayAppendValue (paths, path);
+            CFRelease (path);
+        }
+
+        // Nothing exists yet to watch; the roots are checked for separately
+        if (CFArrayGetCount (paths) == 0)
+        {
+            CFRelease (paths);
+            valid = true;
+            return;
+        }
+
+        FSEventStreamContext context {};
+        context.info = this;
+
+        stream = FSEventStreamCreate (kCFAllocatorDefault, &FSEventsBackend::callback, &context, paths,
+                                      kFSEventStreamEventIdSinceNow, 0.05,
+                                      kFSEventStreamCreateFlagFileEvents | kFSEventStreamCreateFlagNoDefer
+                                      | kFSEventStreamCreateFlagWatchRoot);
+        CFRelease (paths);
+
+        if (stream == nullptr)
+            return;
+
+        queue = dispatch_queue_create ("Beatwerk directory watcher", DISPATCH_QUEUE_SERIAL);
+        FSEventStreamSetDispatchQueue (stream, queue);
+        valid = FSEventStreamStart (stream);
+    }
+
+    ~FSEventsBackend() override
+    {
+        if (stream != nullptr)
+        {
+            if (valid)
+                FSEventStreamStop (stream);
+
+            FSEventStreamInvalidate (stream);
+            FSEventStreamRelease (stream);
+        }
+
+        if (queue != nullptr)
+        {
+            // Lets a callback already running finish before this goes away
+            dispatch_sync_f (queue, nullptr, [] (void*) {});
+            dispatch_release (queue);
+        }
+    }
+
+    bool isValid() const { return valid; }
+
+    void waitForChanges (int timeoutMs) override
+    {
+        watcher.wait (timeoutMs);
+
+        std::vector<Event> received;
+        {
+            std::lock_guard<std::mutex> lock (eventsMutex);
+            received.swap (events);
+        }
+
+        for (auto& event : received)
+            handleEvent (event);
+    }
+
+private:
+    struct Event
+    {
+        juce::String path;
+        FSEventStreamEventFlags flags;
+    };
+
+    FSEventStreamRef stream = nullptr;
+    dispatch_queue_t queue = nullptr;
+    bool valid = false;
+
+    std::mutex eventsMutex;
+    std::vector<Event> events;
+
+    static void callback (ConstFSEventStreamRef, void* info, size_t numEvents, void* eventPaths,
+                          const FSEventStreamEventFlags eventFlags[], const FSEventStreamEventId[])
+    {
+        auto& self = *static_cast<FSEventsBackend*> (info);
+        auto** paths = static_cast<char**> (eventPaths);
+
+        {
+            std::lock_guard<std::mutex> lock (self.eventsMutex);
+            for (size_t i = 0; i < numEvents; ++i)
+                self.events.push_back ({ juce::String::fromUTF8 (paths[i]), eventFlags[i] });
+        }
+
+        self.watcher.notify();
+    }
+
+    void handleEvent (const Event& event)
+    {
+        const auto flags = event.flags;
+        juce::File file (event.path);
+
+        if ((flags & (kFSEventStreamEventFlagUserDropped | kFSEventStreamEventFlagKernelDropped)) != 0)
+        {
+            watcher.reportOverflow ({});
+            return;
+        }
+
+        if ((flags & kFSEventStreamEventFlagMustScanSubDirs) != 0)
+        {
+            watcher.reportOverflow (file);
+            return;
+        }
+
+        if ((flags & kFSEventStreamEventFlagRootChanged) != 0)
+        {
+            watcher.rootLost (file);
+            return;
+        }
+
+        constexpr FSEventStreamEventFlags itemFlags = kFSEventStreamEventFlagItemCreated
+                                                    | kFSEventStreamEventFlagItemRemoved
+                                                    | kFSEventStreamEventFlagItemRenamed
+                                                    | kFSEventStreamEventFlagItemModified
+                                                    | kFSEventStreamEventFlagItemInodeMetaMod;
+        if ((flags & itemFlags) == 0)
+            return;
+
+        Change change;
+        change.file = file;
+        change.isDirectory = (flags & kFSEventStreamEventFlagItemIsDir) != 0;
+
+        // Flags accumulate while events are coalesced, so whether the item is
+        // there now decides what happened to it
+        if (! (change.isDirectory ? file.isDirectory() : file.existsAsFile()))
+            change.type = Change::Type::deleted;
+        else if ((flags & (kFSEventStreamEventFlagItemCreated | kFSEventStreamEventFlagItemRenamed)) != 0)
+            change.type = Change::Type::created;
+        else if (change.isDirectory)
+            return;     // its own attributes; changes inside it are reported per item
+        else
+            change.type = Change::Type::modified;
+
+        watcher.report (change);
+    }
+};
+
+#elif JUCE_WINDOWS
+//==============================================================================
+// One overlapped ReadDirectoryChangesW per root, watching its whole subtree.
+class DirectoryWatcher::WindowsBackend : public Backend
+{
+public:
+    WindowsBackend (DirectoryWatcher& w, const std::vector<juce::File>& rootsToWatch)
+        : Backend (w)
+    {
+        for (auto& root : rootsToWatch)
+        {
+            // Roots that don't exist yet are checked for separately
+            if (! root.isDirectory())
+                continue;
+
+            auto watch = std::make_unique<Watch>();
+            watch->root = root;
+            watch->handle = CreateFileW (root.getFullPathName().toWideCharPointer(), FILE_LIST_DIRECTORY,
+                                         FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr,
+                                         OPEN_EXISTING, FILE_FLAG_BACKUP_SEMANTICS | FILE_FLAG_OVERLAPPED, nullptr);
+            watch->overlapped.hEvent = CreateEventW (nullptr, TRUE, FALSE, nullptr);
+
+            if (watch->handle == INVALID_HANDLE_VALUE || watch->overlapped.hEvent == nullptr || ! watch->arm())
+            {
+                valid = false;
+                return;
+            }
+
+            watches.push_back (std::move (watch));
+        }
+    }
+
+    bool isValid() const { return valid; }
+
+    void waitForChanges (int timeoutMs) override
+    {
+        std::vector<HANDLE> handles;
+        for (auto& watch : watches)
+            if (watch->pending)
+                handles.push_back (watch->overlapped.hEvent);
+
+        if (handles.empty())
+        {
+            watcher.wait (timeoutMs);
+            return;
+        }
+
+        auto result = WaitForMultipleObjects ((DWORD) handles.size(), handles.data(), FALSE, (DWORD) timeoutMs);
+        if (result == WAIT_TIMEOUT || result == WAIT_FAILED)
+            return;
+
+        // More than one may have completed
+        for (auto& watch : watches)
+            if (watch->pending && WaitForSingleObject (watch->overlapped.hEvent, 0) == WAIT_OBJECT_0)
+                readChanges (*watch);
+    }
+
+private:
+    struct Watch
+    {
+        juce::File root;
+        HANDLE handle = INVALID_HANDLE_VALUE;
+        OVERLAPPED overlapped {};
+        bool pending = false;
+        alignas (DWORD) char buffer[65536];     // the most a network share will fill
+
+        ~Watch()
+        {
+            if (pending)
+            {
+                // The buffer must outlive the cancelled read
+                CancelIo (handle);
+                DWORD ignored = 0;
+                GetOverlappedResult (handle, &overlapped, &ignored, TRUE);
+            }
+
+            if (handle != INVALID_HANDLE_VALUE)
+                CloseHandle (handle);
+
+            if (overlapped.hEvent != nullptr)
+                CloseHandle (overlapped.hEvent);
+        }
+
+        bool arm()
+        {
+            ResetEvent (overlapped.hEvent);
+            pending = ReadDirectoryChangesW (handle, buffer, sizeof (buffer), TRUE,
+                                             FILE_NOTIFY_CHANGE_FILE_NAME | FILE_NOTIFY_CHANGE_DIR_NAME
+                                             | FILE_NOTIFY_CHANGE_SIZE | FILE_NOTIFY_CHANGE_LAST_WRITE,
+                                             nullptr, &overlapped, nullptr) != 0;
+            return pending;
+        }
+    };
+
+    std::vector<std::unique_ptr<Watch>> watches;
+    bool valid = true;
+
+    void readChanges (Watch& watch)
+    {
+        watch.pending = false;
+
+        DWORD numBytes = 0;
+        if (! GetOverlappedResult (watch.handle, &watch.overlapped, &numBytes, FALSE))
+        {
+            // The root was deleted or became unreadable
+            ResetEvent (watch.overlapped.hEvent);
+            watcher.rootLost (watch.root);
+            return;
+        }
+
+        // Zero bytes means more changed than fitted in the buffer
+        if (numBytes == 0)
+            watcher.reportOverflow (watch.root);
+        else
+            handleNotifications (watch);
+
+        if (! watch.arm())
+            watcher.rootLost (watch.root);
+    }
+
+    void handleNotifications (const Watch& watch)
+    {
+        for (DWORD offset = 0;;)
+        {
+            auto* info = reinterpret_cast<const FILE_NOTIFY_INFORMATION*> (watch.buffer + offset);
+
+            Change change;
+            change.file = watch.root.getChildFile (juce::String (info->FileName, info->FileNameLength / sizeof (WCHAR)));
+
+            switch (info->Action)
+            {
+                case FILE_ACTION_ADDED:
+                case FILE_ACTION_RENAMED_NEW_NAME:
+                    change.type = Change::Type::created;
+                    change.isDirectory = change.file.isDirectory();
+                    break;
+
+                case FILE_ACTION_REMOVED:
+                case FILE_ACTION_RENAMED_OLD_NAME:
+                    // Already gone, so there's no telling what it was
+                    change.type = Change::Type::deleted;
+                    change.isDirectory = true;
+                    break;
+
+                default:
+                    change.type = Change::Type::modified;
+                    change.isDirectory = change.file.isDirectory();
+                    break;
+            }
+
+            // A directory's own timestamp changes with its contents, which are
+            // reported per item
+            if (! (change.type == Change::Type::modified && change.isDirectory))
+                watcher.report (change);
+
+            if (info->NextEntryOffset == 0)
+                break;
+
+            offset += info->NextEntryOffset;
+        }
+    }
+};
+#endif
+
+//==============================================================================
+class DirectoryWatcher::PollingBackend : public Backend
+{
+public:
+    PollingBackend (DirectoryWatcher& w, const std::vector<juce::File>& rootsToWatch)
+        : Backend (w), roots (rootsToWatch)
+    {
+        for (auto& root : roots)
+            snapshots.push_back (takeSnapshot (root));
+
+        nextPollMs = juce::Time::getMillisecondCounter() + (juce::uint32) kPollIntervalMs;
+    }
+
+    void waitForChanges (int timeoutMs) override
+    {
+        watcher.wait (timeoutMs);
+
+        auto now = juce::Time::getMillisecondCounter();
+        if ((juce::int32) (now - nextPollMs) < 0)
+            return;
+
+        for (size_t i = 0; i < roots.size(); ++i)
+        {
+            auto current = takeSnapshot (roots[i]);
+            compare (snapshots[i], current);
+            snapshots[i] = std::move (current);
+        }
+
+        nextPollMs = juce::Time::getMillisecondCounter() + (juce::uint32) kPollIntervalMs;
+    }
+
+private:
+    struct Stamp
+    {
+        juce::int64 modificationTime = 0;
+        juce::int64 size = 0;
+        bool isDirectory = false;
+    };
+
+    using Snapshot = std::map<juce::String, Stamp>;
+
+    std::vector<juce::File> roots;
+    std::vector<Snapshot> snapshots;
+    juce::uint32 nextPollMs = 0;
+
+    static Snapshot takeSnapshot (const juce::File& root)
+    {
+        Snapshot snapshot;
+
+        if (root.isDirectory())
+            for (const auto& entry : juce::RangedDirectoryIterator (root, true, "*", juce::File::findFilesAndDirectories))
+                snapshot[entry.getFile().getFullPathName()] = { entry.getModificationTime().toMilliseconds(),
+                                                                entry.getFileSize(), entry.isDirectory() };
+
+        return snapshot;
+    }
+
+    void compare (const Snapshot& before, const Snapshot& after)
+    {
+        for (auto& [path, stamp] : after)
+        {
+            auto previous = before.find (path);
+
+            if (previous == before.end() || previous->second.isDirectory != stamp.isDirectory)
+                watcher.report ({ Change::Type::created, juce::File (path), stamp.isDirectory });
+            else if (! stamp.isDirectory && (previous->second.modificationTime != stamp.modificationTime
+                                             || previous->second.size != stamp.size))
+                watcher.report ({ Change::Type::modified, juce::File (path), false });
+        }
+
+        for (auto& [path, stamp] : before)
+            if (after.find (path) == after.end())
+                watcher.report ({ Change::Type::deleted, juce::File (path), stamp.isDirectory });
+    }
+};
+
+//==============================================================================
+DirectoryWatcher::DirectoryWatcher()
+    : juce::Thread ("Beatwerk directory watcher")
+{
+    startThread (juce::Thread::Priority::low);
+}
+
+DirectoryWatcher::~DirectoryWatcher()
+{
+    stopThread (5000);
+}
+
+void DirectoryWatcher::setDirectories (std::vector<juce::File> newRoots)
+{
+    {
+        std::lock_guard<std::mutex> lock (rootsMutex);
+        requestedRoots = std::move (newRoots);
+    }
+
+    rootsChanged.store (true);
+    notify();
+}
+
+void DirectoryWatcher::run()
+{
+    while (! threadShouldExit())
+    {
+        if (rootsChanged.exchange (false))
+            startWatching();
+
+        if (backend != nullptr)
+            backend->waitForChanges (kTickMs);
+        else
+            wait (-1);
+
+        checkRoots();
+        deliverDueChanges();
+    }
+}
+
+void DirectoryWatcher::startWatching()
+{
+    {
+        std::lock_guard<std::mutex> lock (rootsMutex);
+        roots = requestedRoots;
+    }
+
+    // Anything still pending belonged to the old roots
+    pending.assign (roots.size(), {});
+
+    createBackend();
+}
+
+void DirectoryWatcher::createBackend()
+{
+    backend.reset();
+
+    rootsPresent.clear();
+    for (auto& root : roots)
+        rootsPresent.push_back (root.isDirectory());
+
+    rootsNeedRearming = false;
+    nextRootCheckMs = juce::Time::getMillisecondCounter() + (juce::uint32) kRootCheckIntervalMs;
+
+    if (roots.empty())
+        return;
+
+   #if JUCE_LINUX
+    auto native = std::make_unique<InotifyBackend> (*this, roots);
+   #elif JUCE_MAC
+    auto native = std::make_unique<FSEventsBackend> (*this, roots);
+   #elif JUCE_WINDOWS
+    auto native = std::make_unique<WindowsBackend> (*this, roots);
+   #endif
+
+   #if JUCE_LINUX || JUCE_MAC || JUCE_WINDOWS
+    if (native->isValid())
+    {
+        backend = std::move (native);
+        return;
+    }
+   #endif
+
+    backend = std::make_unique<PollingBackend> (*this, roots);
+}
+
+// Watches die with their root, and a root that didn't exist has none, so the
+// backend is recreated whenever one comes or goes
+void DirectoryWatcher::checkRoots()
+{
+    auto now = juce::Time::getMillisecondCounter();
+    if (! rootsNeedRearming && (juce::int32) (now - nextRootCheckMs) < 0)
+        return;
+
+    nextRootCheckMs = now + (juce::uint32) kRootCheckIntervalMs;
+    bool rearm = rootsNeedRearming;
+
+    for (size_t i = 0; i < roots.size(); ++i)
+    {
+        if (roots[i].isDirectory() != rootsPresent[i])
+        {
+            reportOverflow (roots[i]);
+            rearm = true;
+        }
+    }
+
+    if (rearm)
+        createBackend();
+}
+
+void DirectoryWatcher::report (const Change& change)
+{
+    auto now = juce::Time::getMillisecondCounter();
+
+    // Nested roots each get the change
+    for (size_t i = 0; i < roots.size(); ++i)
+    {
+        if (! change.file.isAChildOf (roots[i]))
+            continue;
+
+        auto& batch = pending[i];
+        if (batch.changes.empty() && ! batch.overflowed)
+            batch.firstChangeMs = now;
+        batch.lastChangeMs = now;
+
+        auto [existing, inserted] = batch.changes.try_emplace (change.file.getFullPathName(), change);
+        if (inserted)
+            continue;
+
+        auto& merged = existing->second;
+
+        if (merged.type == Change::Type::created)
+        {
+            // Came and went before anyone looked
+            if (change.type == Change::Type::deleted)
+                batch.changes.erase (existing);
+        }
+        else if (merged.type == Change::Type::deleted)
+        {
+            if (change.type != Change::Type::deleted)
+                merged = { Change::Type::modified, change.file, change.isDirectory };
+        }
+        else if (change.type == Change::Type::deleted)
+        {
+            merged = change;
+        }
+    }
+}
+
+void DirectoryWatcher::reportOverflow (const juce::File& dir)
+{
+    auto now = juce::Time::getMillisecondCounter();
+
+    for (size_t i = 0; i < roots.size(); ++i)
+    {
+        if (dir != juce::File() && ! isWithin (dir, roots[i]))
+            continue;
+
+        auto& batch = pending[i];
+        if (batch.changes.empty() && ! batch.overflowed)
+            batch.firstChangeMs = now;
+        batch.lastChangeMs = now;
+
+        batch.overflowed = true;
+        batch.changes.clear();
+    }
+}
+
+void DirectoryWatcher::rootLost (const juce::File& root)
+{
+    reportOverflow (root);
+    rootsNeedRearming = true;
+}
+
+void DirectoryWatcher::deliverDueChanges()
+{
+    auto now = juce::Time::getMillisecondCounter();
+
+    for (size_t i = 0; i < roots.size(); ++i)
+    {
+        auto& batch = pending[i];
+        if (batch.changes.empty() && ! batch.overflowed)
+            continue;
+
+        if (now - batch.lastChangeMs < (juce::uint32) kDebounceMs
+            && now - batch.firstChangeMs < (juce::uint32) kMaxDelayMs)
+            continue;
+
+        ChangeSet changeSet;
+        changeSet.root = roots[i];
+        changeSet.overflowed = batch.overflowed;
+
+        for (auto& [path, change] : batch.changes)
+            changeSet.changes.push_back (change);
+
+        batch = {};
+
+        if (onChanges)
+            onChanges (changeSet);
+    }
+}
@@ -0,0 +1,96 @@
+#pragma once
+#include <juce_core/juce_core.h>
+#include <atomic>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+// Watches directory trees for changes and reports them in batches.
+//
+// Uses inotify on Linux, with a watch on every directory in each tree,
+// FSEvents on macOS and ReadDirectoryChangesW on Windows. If none of those
+// is available, e.g. inotify runs out of watches, the trees are listed every
+// kPollIntervalMs and compared. Changes are collected until a tree has been
+// quiet for kDebounceMs, then reported together, with repeated changes to
+// one path merged; a file created and deleted in between isn't reported.
+//
+// A root that doesn't exist yet, or is deleted or moved away, is checked for
+// every kRootCheckIntervalMs and watched again, with an overflow reported for
+// it, once it is back.
+class DirectoryWatcher : private juce::Thread
+{
+public:
+    DirectoryWatcher();
+    ~DirectoryWatcher() override;
+
+    struct Change
+    {
+        enum class Type { created, modified, deleted };
+
+        Type type = Type::modified;
+        juce::File file;
+        // For a directory, modified means re-read all of it. Deletions the
+        // backend can't classify are reported as directories, which covers
+        // both the path and anything under it.
+        bool isDirectory = false;
+    };
+
+    struct ChangeSet
+    {
+        juce::File root;
+        std::vector<Change> changes;
+        bool overflowed = false;    // changes were lost; re-read the whole tree
+    };
+
+    // Replaces the watched trees.
+    void setDirectories (std::vector<juce::File> roots);
+
+    // Called on the watcher thread with the changes under one root. Set it
+    // before calling setDirectories.
+    std::function<void (const ChangeSet&)> onChanges;
+
+    static constexpr int kDebounceMs = 300;
+    static constexpr int kMaxDelayMs = 2000;    // a steady stream of changes is still reported this often
+    static constexpr int kPollIntervalMs = 5000;
+    static constexpr int kRootCheckIntervalMs = 1000;
+
+private:
+    class Backend;
+    class InotifyBackend;
+    class FSEventsBackend;
+    class WindowsBackend;
+    class PollingBackend;
+
+    struct Pending
+    {
+        std::map<juce::String, Change> changes;     // by full path
+        bool overflowed = false;
+        juce::uint32 firstChangeMs = 0;
+        juce::uint32 lastChangeMs = 0;
+    };
+
+    std::mutex rootsMutex;
+    std::vector<juce::File> requestedRoots;
+    std::atomic<bool> rootsChanged { false };
+
+    // Only touched on the watcher thread
+    std::vector<juce::File> roots;
+    std::vector<Pending> pending;
+    std::unique_ptr<Backend> backend;
+    std::vector<bool> rootsPresent;     // whether each root existed when the backend was created
+    bool rootsNeedRearming = false;
+    juce::uint32 nextRootCheckMs = 0;
+
+    void run() override;
+    void startWatching();
+    void createBackend();
+    void checkRoots();
+    void report (const Change& change);
+    void reportOverflow (const juce::File& dir);
+    void rootLost (const juce::File& root);
+    void deliverDueChanges();
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (DirectoryWatcher)
+};
@@ -1,23 +1,36 @@
 #pragma once
 #include <juce_core/juce_core.h>
 #include "MidiMapper.h"
-#include <vector>
+#include <span>
 
+// The kits are compiled from Resources/DrumKits.txt into constexpr tables
+// at build time, so nothing here allocates and every pointer and span stays
+// valid for the life of the process.
 struct DrumKitDefinition
 {
-    juce::String id;
-    juce::String name;
-    juce::String manufacturer;
-    std::vector<PadInfo> pads;
+    const char* id;
+    const char* name;
+    const char* manufacturer;
+    std::span<const PadInfo> pads;
     int columns = 4;
 };
 
+struct DrumKitManufacturer
+{
+    const char* name;
+    std::span<const DrumKitDefinition* const> kits;
+};
+
 class DrumKitLibrary
 {
 public:
-    static const std::vector<DrumKitDefinition>& getAllKits();
+    static std::span<const DrumKitDefinition> getAllKits();
+
+    // Constant time, through a perfect hash on the id.
     static const DrumKitDefinition* findKit (const juce::String& id);
     static const DrumKitDefinition& getDefaultKit();
-    static std::vector<juce::String> getManufacturers();
-    static std::vector<const DrumKitDefinition*> getKitsByManufacturer (const juce::String& mfr);
+
+    // In the order the manufacturers first appear in the data file.
+    static std::span<const DrumKitManufacturer> getManufacturers();
+    static std::span<const DrumKitDefinition* const> getKitsByManufacturer (const juce::String& mfr);
 };
@@ -0,0 +1,27 @@
+#pragma once
+#include <cstdint>
+#include <string_view>
+
+// The hash behind the drum kit library's perfect hash table. Shared by
+// DrumKitLibrary and Tools/KitTableGenerator, which picks the seeds, so it
+// must not depend on JUCE.
+//
+// Lookups hash and displace: hash (id, 0) picks a bucket, and the bucket's
+// seed places the id in its own slot.
+namespace KitIdHash
+{
+    // FNV-1a, with the seed mixed into the offset basis
+    constexpr std::uint32_t hash (std::string_view id, std::uint32_t seed) noexcept
+    {
+        std::uint32_t h = 2166136261u ^ (seed * 0x9e3779b9u);
+
+        for (char c : id)
+        {
+            h ^= (std::uint8_t) c;
+            h *= 16777619u;
+        }
+
+        h ^= h >> 15;
+        return h;
+    }
+}
@@ -0,0 +1,119 @@
+#include "KitLoader.h"
+#include <array>
+
+KitLoader::KitLoader (SampleEngine& engine)
+    : sampleEngine (engine),
+      pool (juce::ThreadPoolOptions{}
+                .withThreadName ("Beatwerk kit loader")
+                .withNumberOfThreads (juce::jmax (2, juce::SystemStats::getNumCpus() - 1)))
+{
+}
+
+KitLoader::~KitLoader()
+{
+    cancel();
+    pool.removeAllJobs (true, 5000);
+}
+
+void KitLoader::cancel()
+{
+    std::lock_guard<std::mutex> lock (publishMutex);
+    ++generation;
+    pendingPads.store (0);
+    pool.removeAllJobs (false, 0);
+}
+
+void KitLoader::loadKit (const std::vector<PadRequest>& pads,
+                         const std::map<int, float>& volumes)
+{
+    juce::uint32 loadGeneration;
+    std::vector<const PadRequest*> toDecode;
+
+    {
+        std::lock_guard<std::mutex> lock (publishMutex);
+        loadGeneration = ++generation;
+        pool.removeAllJobs (false, 0);
+
+        // The kit is assembled off to the side and swapped in as a whole
+        sampleEngine.beginKit();
+
+        std::array<bool, 128> requested {};
+
+        for (auto& pad : pads)
+        {
+            if (pad.midiNote < 0 || pad.midiNote >= (int) requested.size())
+                continue;
+
+            requested[(size_t) pad.midiNote] = true;
+
+            if (pad.file.existsAsFile())
+            {
+                // Unchanged pads keep their sample, and keep sounding
+                if (sampleEngine.getSampleFile (pad.midiNote) == pad.file)
+                    continue;
+
+                if (auto data = sampleEngine.findLoadedSample (pad.file))
+                    sampleEngine.stagePad (pad.midiNote, std::move (data));
+                else
+                    toDecode.push_back (&pad);
+            }
+            else
+            {
+                sampleEngine.stagePad (pad.midiNote, nullptr, pad.missingName);
+            }
+        }
+
+        for (int note = 0; note < (int) requested.size(); ++note)
+        {
+            if (! requested[(size_t) note])
+                sampleEngine.stagePad (note, nullptr);
+
+            auto volume = volumes.find (note);
+            sampleEngine.stageVolume (note, volume != volumes.end() ? volume->second : 1.0f);
+        }
+
+        pendingPads.store ((int) toDecode.size());
+
+        if (toDecode.empty())
+            sampleEngine.commitKit();
+    }
+
+    if (toDecode.empty())
+    {
+        if (onKitLoaded)
+            onKitLoaded();
+        return;
+    }
+
+    for (auto* pad : toDecode)
+    {
+        pool.addJob ([this, loadGeneration, note = pad->midiNote, file = pad->file]
+        {
+            loadPad (loadGeneration, note, file);
+        });
+    }
+}
+
+void KitLoader::loadPad (juce::uint32 loadGeneration, int midiNote, const juce::File& file)
+{
+    if (generation.load() != loadGeneration)
+        return;
+
+    auto data = sampleEngine.decodeSample (file);
+
+    bool kitComplete = false;
+    {
+        std::lock_guard<std::mutex> lock (publishMutex);
+        if (generation.load() != loadGeneration)
+            return;
+
+        sampleEngine.stagePad (midiNote, std::move (data));
+        kitComplete = pendingPads.fetch_sub (1) == 1;
+
+        if (kitComplete)
+            sampleEngine.commitKit();
+    }
+
+    if (kitComplete && onKitLoaded)
+        onKitLoaded();
+}
@@ -0,0 +1,54 @@
+#pragma once
+#include <juce_core/juce_core.h>
+#include "SampleEngine.h"
+#include <atomic>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <vector>
+
+// Loads the samples of a kit on a pool of worker threads. Every pad is
+// decoded and resampled independently into the SampleEngine's staging bank
+// while the previous kit keeps playing; the finished kit is then switched in
+// as a whole. The calling thread returns immediately.
+class KitLoader
+{
+public:
+    struct PadRequest
+    {
+        int midiNote = -1;
+        juce::File file;
+        juce::String missingName;   // shown on the pad when file doesn't exist
+    };
+
+    explicit KitLoader (SampleEngine& engine);
+    ~KitLoader();
+
+    // Starts loading the given pads. Pads that already hold the requested
+    // file are left alone and pads not in the list are cleared. If every
+    // sample is already loaded, e.g. by KitPrefetcher, the kit is switched in
+    // before this returns; otherwise that happens once the workers finish.
+    // Any load still running from an earlier call is abandoned.
+    void loadKit (const std::vector<PadRequest>& pads,
+                  const std::map<int, float>& volumes = {});
+
+    void cancel();
+    bool isLoading() const { return pendingPads.load() > 0; }
+
+    // Called once the kit has been switched in, from a worker thread or from
+    // loadKit's caller when nothing needed decoding. Owned by the processor;
+    // set it once, before the first load.
+    std::function<void()> onKitLoaded;
+
+private:
+    SampleEngine& sampleEngine;
+    juce::ThreadPool pool;
+
+    std::mutex publishMutex;
+    std::atomic<juce::uint32> generation { 0 };
+    std::atomic<int> pendingPads { 0 };
+
+    void loadPad (juce::uint32 loadGeneration, int midiNote, const juce::File& file);
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (KitLoader)
+};
@@ -0,0 +1,224 @@
+#include "KitPrefetcher.h"
+#include <algorithm>
+
+KitPrefetcher::KitPrefetcher (SampleEngine& engine, PresetManager& presets, RequestBuilder builder)
+    : juce::Thread ("Beatwerk kit prefetcher"),
+      sampleEngine (engine),
+      presetManager (presets),
+      buildRequests (std::move (builder))
+{
+    startThread (juce::Thread::Priority::low);
+}
+
+KitPrefetcher::~KitPrefetcher()
+{
+    ++generation;
+    stopThread (5000);
+}
+
+void KitPrefetcher::setEnabled (bool shouldBeEnabled)
+{
+    enabled.store (shouldBeEnabled);
+    ++generation;
+    notify();
+}
+
+void KitPrefetcher::setDepth (int numPresetsEachSide)
+{
+    depth.store (juce::jlimit (1, kMaxDepth, numPresetsEachSide));
+}
+
+void KitPrefetcher::setMemoryBudget (juce::int64 bytes)
+{
+    memoryBudget.store (juce::jmax ((juce::int64) 0, bytes));
+    ++generation;
+    notify();
+}
+
+void KitPrefetcher::retarget (std::vector<juce::File> presetFiles)
+{
+    {
+        std::lock_guard<std::mutex> lock (targetMutex);
+        targets = std::move (presetFiles);
+    }
+
+    ++generation;
+    notify();
+}
+
+void KitPrefetcher::pin (std::vector<juce::File> presetFiles)
+{
+    {
+        std::lock_guard<std::mutex> lock (targetMutex);
+        pinnedTargets = std::move (presetFiles);
+        pinningComplete.store (pinnedTargets.empty());
+    }
+
+    ++generation;
+    notify();
+}
+
+void KitPrefetcher::run()
+{
+    juce::uint32 handled = 0;
+
+    while (! threadShouldExit())
+    {
+        auto current = generation.load();
+        if (current == handled)
+        {
+            wait (-1);
+            continue;
+        }
+
+        handled = current;
+        update (current);
+    }
+}
+
+void KitPrefetcher::update (juce::uint32 updateGeneration)
+{
+    std::vector<juce::File> wanted, pinned;
+    {
+        std::lock_guard<std::mutex> lock (targetMutex);
+        wanted = targets;
+        pinned = pinnedTargets;
+    }
+
+    if (! enabled.load())
+        wanted.clear();
+
+    // Rebuild pinned kits first, then nearest first, reusing kits already
+    // held, until the budget runs out
+    std::map<juce::File, std::vector<SampleData::Ptr>> kept;
+    std::set<const SampleData*> counted;
+    std::set<juce::File> countedFiles;
+    juce::int64 pinnedSize = 0, used = 0;
+    const auto budget = memoryBudget.load();
+
+    auto takeKit = [&] (const juce::File& presetFile, std::vector<SampleData::Ptr>& samples, bool resident)
+    {
+        auto held = heldKits.find (presetFile);
+        if (held != heldKits.end())
+            samples = std::move (held->second);
+
+        if (loadKit (presetFile, samples, resident, updateGeneration))
+            return true;
+
+        // Superseded part way; keep everything for the next pass to sort out
+        kept[presetFile] = std::move (samples);
+        for (auto& [file, kit] : kept)
+            heldKits[file] = std::move (kit);
+        return false;
+    };
+
+    for (auto& presetFile : pinned)
+    {
+        if (kept.count (presetFile) != 0)
+            continue;
+
+        std::vector<SampleData::Ptr> samples;
+        if (! takeKit (presetFile, samples, true))
+            return;
+
+        for (auto& sample : samples)
+        {
+            countedFiles.insert (sample->file);
+            if (counted.insert (sample.get()).second)
+                pinnedSize += getSize (*sample);
+        }
+
+        kept[presetFile] = std::move (samples);
+        pinnedMemory.store (pinnedSize);
+    }
+
+    pinnedMemory.store (pinnedSize);
+    pinningComplete.store (true);
+
+    for (auto& presetFile : wanted)
+    {
+        if (kept.count (presetFile) != 0)
+            continue;
+
+        // Checked before loading, so a kit that doesn't fit is never decoded
+        if (used + estimateKitSize (presetFile, countedFiles) > budget)
+            break;
+
+        std::vector<SampleData::Ptr> samples;
+        if (! takeKit (presetFile, samples, false))
+            return;
+
+        for (auto& sample : samples)
+        {
+            countedFiles.insert (sample->file);
+            if (counted.insert (sample.get()).second)
+                used += getSize (*sample);
+        }
+
+        kept[presetFile] = std::move (samples);
+    }
+
+    // Released here; the pool frees whatever nothing else uses
+    heldKits = std::move (kept);
+}
+
+bool KitPrefetcher::loadKit (const juce::File& presetFile, std::vector<SampleData::Ptr>& samples,
+                             bool resident, juce::uint32 updateGeneration)
+{
+    auto kit = presetManager.readPreset (presetFile);
+    if (kit.name.isEmpty())
+        return true;
+
+    const double sampleRate = sampleEngine.getSampleRate();
+
+    // Samples held from before a rate change are no use to the next load,
+    // nor are mapped ones once the kit is pinned
+    samples.erase (std::remove_if (samples.begin(), samples.end(),
+                                   [sampleRate, resident] (const SampleData::Ptr& s)
+                                   {
+                                       return s->sampleRate != sampleRate || (resident && ! s->resident);
+                                   }),
+                   samples.end());
+
+    for (auto& request : buildRequests (kit))
+    {
+        if (generation.load() != updateGeneration || threadShouldExit())
+            return false;
+
+        if (! request.file.existsAsFile())
+            continue;
+
+        bool alreadyHeld = std::any_of (samples.begin(), samples.end(),
+                                        [&request] (const SampleData::Ptr& s) { return s->file == request.file; });
+
+        if (! alreadyHeld)
+            if (auto data = sampleEngine.decodeSample (request.file, resident))
+                samples.push_back (std::move (data));
+    }
+
+    return true;
+}
+
+// Samples already counted for an earlier kit are shared, so they add nothing
+juce::int64 KitPrefetcher::estimateKitSize (const juce::File& presetFile, const std::set<juce::File>& countedFiles)
+{
+    auto kit = presetManager.readPreset (presetFile);
+    if (kit.name.isEmpty())
+        return 0;
+
+    std::set<juce::File> files;
+    for (auto& request : buildRequests (kit))
+        if (countedFiles.count (request.file) == 0 && request.file.existsAsFile())
+            files.insert (request.file);
+
+    juce::int64 size = 0;
+    for (auto& file : files)
+        size += sampleEngine.estimateSampleSize (file);
+
+    return size;
+}
+
+juce::int64 KitPrefetcher::getSize (const SampleData& data)
+{
+    return (juce::int64) data.buffer.getNumChannels() * data.buffer.getNumSamples() * (juce::int64) sizeof (float);
+}
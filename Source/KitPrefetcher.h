@@ -0,0 +1,84 @@
+#pragma once
+#include <juce_core/juce_core.h>
+#include "KitLoader.h"
+#include "PresetManager.h"
+#include "SampleEngine.h"
+#include <atomic>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <set>
+#include <vector>
+
+// Keeps the samples of the presets around the current one loaded, so that
+// stepping to a neighbour only has to publish them. The prefetched samples
+// live in the SamplePool; this class just holds references to keep them
+// there, nearest neighbour first, within a memory budget.
+//
+// Pinned presets, i.e. the setlist, are held as well, in full and outside
+// the budget, whether or not prefetching is enabled. Their samples are
+// loaded resident, so none of them plays from mapped cache pages.
+//
+// Work happens on a background thread; retarget() returns immediately.
+class KitPrefetcher : private juce::Thread
+{
+public:
+    using RequestBuilder = std::function<std::vector<KitLoader::PadRequest> (const DkitPreset&)>;
+
+    KitPrefetcher (SampleEngine& engine, PresetManager& presets, RequestBuilder buildRequests);
+    ~KitPrefetcher() override;
+
+    void setEnabled (bool shouldBeEnabled);
+    bool isEnabled() const { return enabled.load(); }
+
+    // Presets to keep on each side of the current one.
+    void setDepth (int numPresetsEachSide);
+    int getDepth() const { return depth.load(); }
+
+    void setMemoryBudget (juce::int64 bytes);
+    juce::int64 getMemoryBudget() const { return memoryBudget.load(); }
+
+    // The preset files to keep warm, nearest first. Whatever isn't listed is
+    // released.
+    void retarget (std::vector<juce::File> presetFiles);
+
+    // The preset files to hold regardless of budget. Replaces any earlier list.
+    void pin (std::vector<juce::File> presetFiles);
+
+    // Memory held by the pinned presets' samples so far, and whether all of
+    // them are loaded.
+    juce::int64 getPinnedMemory() const { return pinnedMemory.load(); }
+    bool isPinningComplete() const { return pinningComplete.load(); }
+
+    static constexpr int kMaxDepth = 4;
+
+private:
+    SampleEngine& sampleEngine;
+    PresetManager& presetManager;
+    RequestBuilder buildRequests;
+
+    std::atomic<bool> enabled { false };
+    std::atomic<int> depth { 1 };
+    std::atomic<juce::int64> memoryBudget { (juce::int64) 1024 * 1024 * 1024 };
+
+    std::mutex targetMutex;
+    std::vector<juce::File> targets;
+    std::vector<juce::File> pinnedTargets;
+    std::atomic<juce::uint32> generation { 0 };
+
+    std::atomic<juce::int64> pinnedMemory { 0 };
+    std::atomic<bool> pinningComplete { true };
+
+    // Only touched on the background thread
+    std::map<juce::File, std::vector<SampleData::Ptr>> heldKits;
+
+    void run() override;
+    void update (juce::uint32 updateGeneration);
+    bool loadKit (const juce::File& presetFile, std::vector<SampleData::Ptr>& samples,
+                  bool resident, juce::uint32 updateGeneration);
+    juce::int64 estimateKitSize (const juce::File& presetFile, const std::set<juce::File>& countedFiles);
+
+    static juce::int64 getSize (const SampleData& data);
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (KitPrefetcher)
+};
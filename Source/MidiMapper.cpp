@@ -3,58 +3,108 @@
 
 MidiMapper::MidiMapper()
 {
-    activeKit = &DrumKitLibrary::getDefaultKit();
+    activeKit.store (&DrumKitLibrary::getDefaultKit());
+
+    std::lock_guard<std::mutex> lock (settingsMutex);
+    rebuildRouting();
 }
 
 void MidiMapper::setActiveKit (const juce::String& kitId)
 {
     auto* kit = DrumKitLibrary::findKit (kitId);
-    if (kit != nullptr)
-        activeKit = kit;
+    if (kit == nullptr)
+        return;
+
+    std::lock_guard<std::mutex> lock (settingsMutex);
+    activeKit.store (kit);
+    rebuildRouting();
 }
 
 juce::String MidiMapper::getActiveKitId() const
 {
-    if (activeKit != nullptr)
-        return activeKit->id;
+    if (auto* kit = activeKit.load())
+        return kit->id;
     return {};
 }
 
-const std::vector<PadInfo>& MidiMapper::getAllPads() const
+std::span<const PadInfo> MidiMapper::getAllPads() const
+{
+    jassert (activeKit.load() != nullptr);
+    return activeKit.load()->pads;
+}
+
+void MidiMapper::rebuildRouting()
 {
-    jassert (activeKit != nullptr);
-    return activeKit->pads;
+    RoutingTable::Ptr table = new RoutingTable();
+
+    for (auto& pad : activeKit.load()->pads)
+        if (juce::isPositiveAndBelow (pad.midiNote, (int) table->pads.size()))
+            table->pads[(size_t) pad.midiNote] = &pad;
+
+    // Next wins if both are on the same CC, as the old comparison order did
+    if (juce::isPositiveAndBelow (nextCCNumber, (int) table->ccActions.size()))
+        table->ccActions[(size_t) nextCCNumber] = NavAction::Next;
+    if (juce::isPositiveAndBelow (prevCCNumber, (int) table->ccActions.size()))
+        table->ccActions[(size_t) prevCCNumber] = NavAction::Previous;
+
+    table->navChannel = navChannel;
+
+    routing.store (table.get());
+    releasePool->retire (std::move (routingOwner));
+    routingOwner = std::move (table);
 }
 
 bool MidiMapper::isPadNote (int midiNote) const
 {
-    for (auto& p : activeKit->pads)
-        if (p.midiNote == midiNote)
-            return true;
-    return false;
+    return getPadInfo (midiNote) != nullptr;
 }
 
 const PadInfo* MidiMapper::getPadInfo (int midiNote) const
 {
-    for (auto& p : activeKit->pads)
-        if (p.midiNote == midiNote)
-            return &p;
-    return nullptr;
+    if (! juce::isPositiveAndBelow (midiNote, 128))
+        return nullptr;
+
+    ReleasePool::ScopedAcquire acquire (*releasePool);
+    return routing.load()->pads[(size_t) midiNote];
 }
 
 void MidiMapper::setNavChannel (int channel)
 {
+    std::lock_guard<std::mutex> lock (settingsMutex);
     navChannel = channel;
+    rebuildRouting();
 }
 
 void MidiMapper::setPrevCCNumber (int cc)
 {
+    std::lock_guard<std::mutex> lock (settingsMutex);
     prevCCNumber = cc;
+    rebuildRouting();
 }
 
 void MidiMapper::setNextCCNumber (int cc)
 {
+    std::lock_guard<std::mutex> lock (settingsMutex);
     nextCCNumber = cc;
+    rebuildRouting();
+}
+
+int MidiMapper::getNavChannel() const
+{
+    std::lock_guard<std::mutex> lock (settingsMutex);
+    return navChannel;
+}
+
+int MidiMapper::getPrevCCNumber() const
+{
+    std::lock_guard<std::mutex> lock (settingsMutex);
+    return prevCCNumber;
+}
+
+int MidiMapper::getNextCCNumber() const
+{
+    std::lock_guard<std::mutex> lock (settingsMutex);
+    return nextCCNumber;
 }
 
 void MidiMapper::startLearn (LearnTarget target)
@@ -77,59 +127,49 @@ MidiMapper::LearnTarget MidiMapper::getLearnTarget() const
     return static_cast<LearnTarget> (learnTarget.load());
 }
 
-bool MidiMapper::processForLearn (const juce::MidiMessage& msg)
+MidiMapper::LearnTarget MidiMapper::processForLearn (const juce::MidiMessage& msg)
 {
     int target = learnTarget.load();
     if (target == 0)
-        return false;
+        return LearnTarget::None;
 
     if (! msg.isController())
-        return false;
+        return LearnTarget::None;
 
     int value = msg.getControllerValue();
     if (value == 0)
-        return false;
-
-    int cc = msg.getControllerNumber();
-    auto learned = static_cast<LearnTarget> (target);
-
-    if (learned == LearnTarget::Prev)
-        prevCCNumber = cc;
-    else if (learned == LearnTarget::Next)
-        nextCCNumber = cc;
+        return LearnTarget::None;
 
     learnTarget.store (0);
-
-    if (onLearnComplete)
-    {
-        auto callback = onLearnComplete;
-        juce::MessageManager::callAsync ([callback, learned, cc] { callback (learned, cc); });
-    }
-
-    return true;
+    return static_cast<LearnTarget> (target);
 }
 
 MidiMapper::NavAction MidiMapper::processForNavigation (const juce::MidiMessage& msg) const
 {
-    if (! msg.isController())
+    if (! msg.isController() || msg.getControllerValue() == 0)
         return NavAction::None;
 
-    if (navChannel > 0 && msg.getChannel() != navChannel)
+    ReleasePool::ScopedAcquire acquire (*releasePool);
+    auto* table = routing.load();
+
+    if (table->navChannel > 0 && msg.getChannel() != table->navChannel)
         return NavAction::None;
 
-    int cc = msg.getControllerNumber();
-    int value = msg.getControllerValue();
+    return table->ccActions[(size_t) msg.getControllerNumber()];
+}
 
-    if (value == 0)
-        return NavAction::None;
+int MidiMapper::processForProgramChange (const juce::MidiMessage& msg) const
+{
+    if (! msg.isProgramChange())
+        return -1;
 
-    if (cc == prevCCNumber)
-        return NavAction::Previous;
+    ReleasePool::ScopedAcquire acquire (*releasePool);
+    auto* table = routing.load();
 
-    if (cc == nextCCNumber)
-        return NavAction::Next;
+    if (table->navChannel > 0 && msg.getChannel() != table->navChannel)
+        return -1;
 
-    return NavAction::None;
+    return msg.getProgramChangeNumber();
 }
 
 bool MidiMapper::isDrumTrigger (const juce::MidiMessage& msg) const
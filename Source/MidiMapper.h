@@ -1,20 +1,27 @@
 #pragma once
 #include <juce_audio_basics/juce_audio_basics.h>
 #include <juce_events/juce_events.h>
+#include "ReleasePool.h"
+#include <array>
 #include <atomic>
 #include <functional>
-#include <string>
-#include <vector>
+#include <mutex>
+#include <span>
 
+// Names point into the DrumKitLibrary tables, which are never freed.
 struct PadInfo
 {
     int midiNote;
-    std::string padName;
-    std::string triggerName;
+    const char* padName;
+    const char* triggerName;
 };
 
 struct DrumKitDefinition;
 
+// Routes incoming MIDI to pads, preset navigation and MIDI Learn. The
+// active kit and navigation settings are compiled into an immutable table
+// that the audio thread reads through one atomic pointer, so every lookup
+// is constant time and settings can change during playback.
 class MidiMapper
 {
 public:
@@ -23,8 +30,8 @@ public:
     bool isPadNote (int midiNote) const;
     const PadInfo* getPadInfo (int midiNote) const;
 
-    const std::vector<PadInfo>& getAllPads() const;
-    const DrumKitDefinition* getActiveKit() const { return activeKit; }
+    std::span<const PadInfo> getAllPads() const;
+    const DrumKitDefinition* getActiveKit() const { return activeKit.load(); }
 
     void setActiveKit (const juce::String& kitId);
     juce::String getActiveKitId() const;
@@ -33,13 +40,16 @@ public:
     void setNavChannel (int channel);
     void setPrevCCNumber (int cc);
     void setNextCCNumber (int cc);
-    int getNavChannel() const { return navChannel; }
-    int getPrevCCNumber() const { return prevCCNumber; }
-    int getNextCCNumber() const { return nextCCNumber; }
+    int getNavChannel() const;
+    int getPrevCCNumber() const;
+    int getNextCCNumber() const;
 
     enum class NavAction { None, Next, Previous };
 
     NavAction processForNavigation (const juce::MidiMessage& msg) const;
+
+    // The program number of a Program Change on the navigation channel, else -1.
+    int processForProgramChange (const juce::MidiMessage& msg) const;
     bool isDrumTrigger (const juce::MidiMessage& msg) const;
 
     // MIDI Learn
@@ -50,16 +60,35 @@ public:
     bool isLearning() const;
     LearnTarget getLearnTarget() const;
 
-    bool processForLearn (const juce::MidiMessage& msg);
-
-    std::function<void (LearnTarget, int)> onLearnComplete;
+    // If a learn is pending and msg completes it, ends the learn and returns
+    // what it was for, else LearnTarget::None. Called on the audio thread;
+    // the UI assigns the CC, msg's controller number, with setPrevCCNumber
+    // or setNextCCNumber.
+    LearnTarget processForLearn (const juce::MidiMessage& msg);
 
 private:
-    const DrumKitDefinition* activeKit = nullptr;
+    struct RoutingTable : public juce::ReferenceCountedObject
+    {
+        using Ptr = juce::ReferenceCountedObjectPtr<RoutingTable>;
+
+        std::array<const PadInfo*, 128> pads {};         // by note, nullptr if not a pad
+        std::array<NavAction, 128> ccActions {};         // by controller number
+        int navChannel = 0;
+    };
 
+    std::atomic<const DrumKitDefinition*> activeKit { nullptr };
+
+    // Settings the table is compiled from
+    mutable std::mutex settingsMutex;
     int navChannel = 0;
     int prevCCNumber = 1;
     int nextCCNumber = 2;
 
+    std::atomic<RoutingTable*> routing { nullptr };
+    RoutingTable::Ptr routingOwner;     // guarded by settingsMutex
+    juce::SharedResourcePointer<ReleasePool> releasePool;
+
     std::atomic<int> learnTarget { 0 };
+
+    void rebuildRouting();   // caller holds settingsMutex
 };
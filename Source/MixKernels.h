@@ -0,0 +1,74 @@
+#pragma once
+#include "SimdOps.h"
+#include <array>
+
+// Voice mixing kernels: dst += src * gain, with gain ramped linearly from
+// startGain to endGain across the block. One instantiation per
+// (source channels, destination channels) pair, so the channel routing is
+// resolved when the kernel is picked rather than inside the sample loop.
+// Sources with more than two channels contribute their first one or two.
+namespace MixKernels
+{
+    using Function = void (*) (float* const* dst, const float* const* src,
+                               int numSamples, float startGain, float endGain) noexcept;
+
+    template <int SrcChannels, int DstChannels>
+    void mix (float* const* dst, const float* const* src,
+              int numSamples, float startGain, float endGain) noexcept
+    {
+        static_assert (SrcChannels >= 1 && SrcChannels <= 2 && DstChannels >= 1 && DstChannels <= 2);
+
+        constexpr bool stereoSource = SrcChannels == 2 && DstChannels == 2;
+
+        float* const dstL = dst[0];
+        float* const dstR = DstChannels == 2 ? dst[1] : nullptr;
+        const float* const srcL = src[0];
+        const float* const srcR = stereoSource ? src[1] : nullptr;
+
+        const float step = numSamples > 0 ? (endGain - startGain) / (float) numSamples : 0.0f;
+        int i = 0;
+
+       #if BEATWERK_SIMD
+        using namespace SimdOps;
+
+        auto gain = ramp (startGain, step);
+        const auto gainStep = splat (step * (float) width);
+
+        for (; i + width <= numSamples; i += width)
+        {
+            const auto left = load (srcL + i);
+            store (dstL + i, mulAdd (load (dstL + i), left, gain));
+
+            if constexpr (stereoSource)
+                store (dstR + i, mulAdd (load (dstR + i), load (srcR + i), gain));
+            else if constexpr (DstChannels == 2)
+                store (dstR + i, mulAdd (load (dstR + i), left, gain));
+
+            gain = add (gain, gainStep);
+        }
+       #endif
+
+        for (; i < numSamples; ++i)
+        {
+            const float g = startGain + step * (float) i;
+            dstL[i] += srcL[i] * g;
+
+            if constexpr (stereoSource)
+                dstR[i] += srcR[i] * g;
+            else if constexpr (DstChannels == 2)
+                dstR[i] += srcL[i] * g;
+        }
+    }
+
+    // Kernels for a source with the given channel count, indexed by
+    // destination channel count - 1.
+    using Row = std::array<Function, 2>;
+
+    inline Row rowForSource (int srcChannels) noexcept
+    {
+        if (srcChannels >= 2)
+            return { &mix<2, 1>, &mix<2, 2> };
+
+        return { &mix<1, 1>, &mix<1, 2> };
+    }
+}
@@ -21,9 +21,15 @@ PadComponent::PadComponent (const PadInfo& info, SampleEngine& engine)
     };
     addAndMakeVisible (volumeSlider);
 
+    thumbnails->addChangeListener (this);
     updateSampleDisplay();
 }
 
+PadComponent::~PadComponent()
+{
+    thumbnails->removeChangeListener (this);
+}
+
 void PadComponent::paint (juce::Graphics& g)
 {
     auto bounds = getLocalBounds().toFloat().reduced (2.0f);
@@ -41,6 +47,16 @@ void PadComponent::paint (juce::Graphics& g)
     g.setColour (bgColour);
     g.fillRoundedRectangle (bounds, 6.0f);
 
+    if (thumbnail != nullptr && ! sampleMissing)
+    {
+        auto waveArea = bounds.reduced (6.0f);
+        waveArea.removeFromBottom ((float) sliderHeight + 2.0f);
+        waveArea.removeFromTop (waveArea.getHeight() * 0.5f);
+
+        thumbnail->draw (g, waveArea, DarkLookAndFeel::accent.withAlpha (isDragging ? 0.08f : 0.18f),
+                         DarkLookAndFeel::accent.withAlpha (isDragging ? 0.12f : 0.3f));
+    }
+
     if (flashAlpha > 0.01f)
     {
         g.setColour (DarkLookAndFeel::triggerFlash.withAlpha (flashAlpha * flashVelocity));
@@ -188,7 +204,7 @@ void PadComponent::mouseUp (const juce::MouseEvent& event)
 
     if (sampleEngine.hasSample (padInfo.midiNote))
     {
-        sampleEngine.noteOn (padInfo.midiNote, 0.7f);
+        sampleEngine.playPad (padInfo.midiNote, 0.7f);
         triggerFlash (0.7f);
     }
 }
@@ -338,6 +354,16 @@ void PadComponent::timerCallback()
     repaint();
 }
 
+void PadComponent::changeListenerCallback (juce::ChangeBroadcaster*)
+{
+    if (thumbnail != nullptr || sampleFile == juce::File())
+        return;
+
+    thumbnail = thumbnails->get (sampleFile);
+    if (thumbnail != nullptr)
+        repaint();
+}
+
 void PadComponent::triggerFlash (float velocity)
 {
     flashAlpha = 1.0f;
@@ -349,6 +375,8 @@ void PadComponent::updateSampleDisplay()
 {
     sampleName = sampleEngine.getSampleName (padInfo.midiNote);
     sampleMissing = sampleEngine.isSampleMissing (padInfo.midiNote);
+    sampleFile = sampleEngine.getSampleFile (padInfo.midiNote);
+    thumbnail = thumbnails->get (sampleFile);
     volumeSlider.setValue (sampleEngine.getPadVolume (padInfo.midiNote), juce::dontSendNotification);
     repaint();
 }
@@ -2,15 +2,18 @@
 #include <juce_gui_extra/juce_gui_extra.h>
 #include "MidiMapper.h"
 #include "SampleEngine.h"
+#include "ThumbnailCache.h"
 #include "LookAndFeel.h"
 
 class PadComponent : public juce::Component,
                      public juce::FileDragAndDropTarget,
                      public juce::DragAndDropTarget,
-                     public juce::Timer
+                     public juce::Timer,
+                     private juce::ChangeListener
 {
 public:
     PadComponent (const PadInfo& padInfo, SampleEngine& engine);
+    ~PadComponent() override;
 
     void paint (juce::Graphics& g) override;
     void resized() override;
@@ -49,6 +52,7 @@ private:
     PadInfo padInfo;
     SampleEngine& sampleEngine;
     juce::String sampleName;
+    juce::File sampleFile;
     bool sampleMissing = false;
     bool isDragOver = false;
     bool isDragging = false;
@@ -61,6 +65,11 @@ private:
 
     juce::Slider volumeSlider;
 
+    juce::SharedResourcePointer<ThumbnailCache> thumbnails;
+    ThumbnailCache::ThumbnailPtr thumbnail;
+
+    void changeListenerCallback (juce::ChangeBroadcaster*) override;
+
     juce::Rectangle<int> getLocateIconBounds() const;
     void drawLocateIcon (juce::Graphics& g) const;
 };
@@ -92,7 +92,19 @@ SettingsOverlay::SettingsOverlay (BeatwerkProcessor& proc) : processor (proc)
     addAndMakeVisible (presetsBrowseButton);
 
     // Import from Ableton
-    importAbletonButton.onClick = [this] { doAbletonImport(); };
+    importAbletonButton.onClick = [this]
+    {
+        if (! importRunning)
+        {
+            doAbletonImport();
+        }
+        else if (importCancelled != nullptr)
+        {
+            importCancelled->store (true);
+            importAbletonButton.setEnabled (false);
+            importAbletonButton.setButtonText ("Cancelling...");
+        }
+    };
     addAndMakeVisible (importAbletonButton);
 
     importProgressBar.setVisible (false);
@@ -141,6 +153,69 @@ SettingsOverlay::SettingsOverlay (BeatwerkProcessor& proc) : processor (proc)
     };
     addAndMakeVisible (navChannelBox);
 
+    // Sample-rate conversion
+    resampleQualityLabel.setText ("Resampling Quality:", juce::dontSendNotification);
+    resampleQualityLabel.setColour (juce::Label::textColourId, DarkLookAndFeel::textDim);
+    addAndMakeVisible (resampleQualityLabel);
+
+    for (auto quality : { Resampler::Quality::fast, Resampler::Quality::standard, Resampler::Quality::high })
+        resampleQualityBox.addItem (Resampler::getQualityName (quality), (int) quality + 1);
+    resampleQualityBox.setSelectedId ((int) processor.getSampleEngine().getResampleQuality() + 1);
+    resampleQualityBox.onChange = [this]
+    {
+        processor.getSampleEngine().setResampleQuality ((Resampler::Quality) (resampleQualityBox.getSelectedId() - 1));
+    };
+    addAndMakeVisible (resampleQualityBox);
+
+    // Crossfade when the kit changes under sounding voices
+    kitFadeLabel.setText ("Kit Switch Fade:", juce::dontSendNotification);
+    kitFadeLabel.setColour (juce::Label::textColourId, DarkLookAndFeel::textDim);
+    addAndMakeVisible (kitFadeLabel);
+
+    for (int milliseconds : { 2, 5, 10, 20, 50 })
+        kitFadeBox.addItem (juce::String (milliseconds) + " ms", milliseconds);
+    kitFadeBox.setSelectedId (juce::roundToInt (processor.getSampleEngine().getKitFadeTime()), juce::dontSendNotification);
+    kitFadeBox.onChange = [this]
+    {
+        processor.getSampleEngine().setKitFadeTime ((float) kitFadeBox.getSelectedId());
+    };
+    addAndMakeVisible (kitFadeBox);
+
+    // Neighbour-preset prefetch
+    prefetchLabel.setText ("Preset Prefetch:", juce::dontSendNotification);
+    prefetchLabel.setColour (juce::Label::textColourId, DarkLookAndFeel::textDim);
+    addAndMakeVisible (prefetchLabel);
+
+    auto& prefetcher = processor.getKitPrefetcher();
+
+    prefetchToggle.setToggleState (prefetcher.isEnabled(), juce::dontSendNotification);
+    prefetchToggle.onClick = [this]
+    {
+        processor.getKitPrefetcher().setEnabled (prefetchToggle.getToggleState());
+        processor.updatePrefetchTargets();
+    };
+    addAndMakeVisible (prefetchToggle);
+
+    for (int i = 1; i <= KitPrefetcher::kMaxDepth; ++i)
+        prefetchDepthBox.addItem (juce::String (i) + " each side", i);
+    prefetchDepthBox.setSelectedId (prefetcher.getDepth(), juce::dontSendNotification);
+    prefetchDepthBox.onChange = [this]
+    {
+        processor.getKitPrefetcher().setDepth (prefetchDepthBox.getSelectedId());
+        processor.updatePrefetchTargets();
+    };
+    addAndMakeVisible (prefetchDepthBox);
+
+    for (int megabytes : { 256, 512, 1024, 2048, 4096 })
+        prefetchBudgetBox.addItem (megabytes < 1024 ? juce::String (megabytes) + " MB"
+                                                    : juce::String (megabytes / 1024) + " GB", megabytes);
+    prefetchBudgetBox.setSelectedId ((int) (prefetcher.getMemoryBudget() / (1024 * 1024)), juce::dontSendNotification);
+    prefetchBudgetBox.onChange = [this]
+    {
+        processor.getKitPrefetcher().setMemoryBudget ((juce::int64) prefetchBudgetBox.getSelectedId() * 1024 * 1024);
+    };
+    addAndMakeVisible (prefetchBudgetBox);
+
     prevCCLabel.setText ("Prev CC Number:", juce::dontSendNotification);
     prevCCLabel.setColour (juce::Label::textColourId, DarkLookAndFeel::textDim);
     addAndMakeVisible (prevCCLabel);
@@ -189,21 +264,6 @@ SettingsOverlay::SettingsOverlay (BeatwerkProcessor& proc) : processor (proc)
     };
     addAndMakeVisible (nextLearnButton);
 
-    processor.getMidiMapper().onLearnComplete =
-        [safeThis = juce::Component::SafePointer<SettingsOverlay> (this)]
-        (MidiMapper::LearnTarget target, int cc)
-    {
-        if (safeThis == nullptr)
-            return;
-
-        if (target == MidiMapper::LearnTarget::Prev)
-            safeThis->prevCCBox.setSelectedId (cc + 1, juce::sendNotification);
-        else if (target == MidiMapper::LearnTarget::Next)
-            safeThis->nextCCBox.setSelectedId (cc + 1, juce::sendNotification);
-
-        safeThis->updateLearnButtonStates();
-    };
-
     // Save Preset
     savePresetButton.onClick = [this]
     {
@@ -235,6 +295,21 @@ SettingsOverlay::SettingsOverlay (BeatwerkProcessor& proc) : processor (proc)
     };
     addAndMakeVisible (savePresetButton);
 
+    // Setlist: prev/next stay within it and its presets are held in memory.
+    // Presets are added from the preset list's context menu.
+    setlistToggle.setToggleState (processor.getPresetManager().isSetlistActive(), juce::dontSendNotification);
+    setlistToggle.onClick = [this]
+    {
+        processor.getPresetManager().setSetlistActive (setlistToggle.getToggleState());
+        updateSetlistInfoLabel();
+    };
+    addAndMakeVisible (setlistToggle);
+
+    setlistInfoLabel.setColour (juce::Label::textColourId, DarkLookAndFeel::textDim);
+    addAndMakeVisible (setlistInfoLabel);
+    updateSetlistInfoLabel();
+    startTimer (500);
+
     closeButton.setColour (juce::TextButton::buttonColourId, juce::Colours::transparentBlack);
     closeButton.setColour (juce::TextButton::buttonOnColourId, juce::Colours::transparentBlack);
     closeButton.setColour (juce::TextButton::textColourOffId, DarkLookAndFeel::textDim);
@@ -249,18 +324,16 @@ void SettingsOverlay::populateKitBox()
     kitIds.clear();
 
     int itemId = 1;
-    auto manufacturers = DrumKitLibrary::getManufacturers();
     auto currentKitId = processor.getActiveKitId();
 
-    for (auto& mfr : manufacturers)
+    for (auto& mfr : DrumKitLibrary::getManufacturers())
     {
-        kitBox.addSectionHeading (mfr);
-        auto kits = DrumKitLibrary::getKitsByManufacturer (mfr);
-        for (auto* kit : kits)
+        kitBox.addSectionHeading (mfr.name);
+        for (auto* kit : mfr.kits)
         {
             kitIds.push_back (kit->id);
             kitBox.addItem (kit->name, itemId);
-            if (kit->id == currentKitId)
+            if (currentKitId == kit->id)
                 kitBox.setSelectedId (itemId, juce::dontSendNotification);
             ++itemId;
         }
@@ -276,10 +349,40 @@ void SettingsOverlay::updateKitInfoLabel()
                              + kit->manufacturer, juce::dontSendNotification);
 }
 
+void SettingsOverlay::updateSetlistInfoLabel()
+{
+    auto& presets = processor.getPresetManager();
+    auto& prefetcher = processor.getKitPrefetcher();
+    auto numPresets = (int) presets.getSetlist().size();
+
+    juce::String text = juce::String (numPresets) + (numPresets == 1 ? " preset" : " presets");
+
+    if (presets.isSetlistActive() && numPresets > 0)
+    {
+        auto megabytes = juce::String ((double) prefetcher.getPinnedMemory() / (1024.0 * 1024.0), 0) + " MB";
+        text << (prefetcher.isPinningComplete() ? "  |  " + megabytes + " in memory"
+                                                : "  |  loading... " + megabytes);
+    }
+
+    setlistInfoLabel.setText (text, juce::dontSendNotification);
+}
+
 SettingsOverlay::~SettingsOverlay()
 {
+    if (importCancelled != nullptr)
+        importCancelled->store (true);
+
     processor.getMidiMapper().cancelLearn();
-    processor.getMidiMapper().onLearnComplete = nullptr;
+}
+
+void SettingsOverlay::handleLearnComplete (MidiMapper::LearnTarget target, int cc)
+{
+    if (target == MidiMapper::LearnTarget::Prev)
+        prevCCBox.setSelectedId (cc + 1, juce::sendNotification);
+    else if (target == MidiMapper::LearnTarget::Next)
+        nextCCBox.setSelectedId (cc + 1, juce::sendNotification);
+
+    updateLearnButtonStates();
 }
 
 void SettingsOverlay::updateLearnButtonStates()
@@ -311,32 +414,40 @@ void SettingsOverlay::doAbletonImport()
     {
         importRunning = true;
         importProgress = 0.0;
-        importAbletonButton.setEnabled (false);
-        importAbletonButton.setButtonText ("Importing...");
+        importCancelled = std::make_shared<std::atomic<bool>> (false);
+        importAbletonButton.setButtonText ("Cancel Import");
         importProgressBar.setVisible (true);
         importStatusLabel.setVisible (true);
         importStatusLabel.setText ("Preparing...", juce::dontSendNotification);
 
         auto safeThis = juce::Component::SafePointer<SettingsOverlay> (this);
 
-        juce::Thread::launch ([this, dirs, safeThis]
+        juce::Thread::launch ([this, dirs, safeThis, cancelled = importCancelled]
         {
             auto importResult = AbletonImporter::importFromDirectories (
                 dirs,
                 processor.getSamplesPath(),
                 processor.getPresetsPath(),
                 processor.getAdgParser(),
-                [safeThis] (float progress, const juce::String& status)
+                [safeThis] (const AbletonImporter::Progress& progress)
                 {
-                    juce::MessageManager::callAsync ([safeThis, progress, status]
+                    auto status = juce::String (progress.kitsDone) + " / " + juce::String (progress.kitsTotal) + " kits";
+                    if (progress.bytesQueued > 0)
+                        status << ", " << juce::File::descriptionOfSizeInBytes (progress.bytesCopied)
+                               << " of " << juce::File::descriptionOfSizeInBytes (progress.bytesQueued) << " copied";
+                    if (progress.currentKit.isNotEmpty())
+                        status << "  -  " << progress.currentKit;
+
+                    juce::MessageManager::callAsync ([safeThis, fraction = progress.getFraction(), status]
                     {
                         if (safeThis != nullptr)
                         {
-                            safeThis->importProgress = (double) progress;
+                            safeThis->importProgress = (double) fraction;
                             safeThis->importStatusLabel.setText (status, juce::dontSendNotification);
                         }
                     });
-                });
+                },
+                [cancelled] { return cancelled->load(); });
 
             juce::MessageManager::callAsync ([this, importResult, safeThis]
             {
@@ -344,10 +455,13 @@ void SettingsOverlay::doAbletonImport()
                     return;
 
                 importRunning = false;
-                importProgress = 1.0;
+                importCancelled = nullptr;
+                if (! importResult.cancelled)
+                    importProgress = 1.0;
                 processor.getPresetManager().scanForPresets();
 
-                auto msg = "Imported " + juce::String (importResult.presetsImported) + " presets, "
+                auto msg = juce::String (importResult.cancelled ? "Cancelled - imported " : "Imported ")
+                         + juce::String (importResult.presetsImported) + " presets, "
                          + juce::String (importResult.samplesCopied) + " samples copied";
                 if (importResult.skippedNoSamples > 0)
                     msg += ", " + juce::String (importResult.skippedNoSamples) + " skipped (no audio samples)";
@@ -487,31 +601,58 @@ void SettingsOverlay::resized()
     area.removeFromTop (10);
 
     // MIDI settings
-    navChannelLabel.setBounds (area.removeFromTop (22));
-    navChannelBox.setBounds (area.removeFromTop (28).withWidth (200));
+    {
+        auto labelRow = area.removeFromTop (22);
+        navChannelLabel.setBounds (labelRow.removeFromLeft (210));
+        resampleQualityLabel.setBounds (labelRow.removeFromLeft (210));
+        kitFadeLabel.setBounds (labelRow.withWidth (150));
+
+        auto row = area.removeFromTop (28);
+        navChannelBox.setBounds (row.removeFromLeft (200));
+        row.removeFromLeft (10);
+        resampleQualityBox.setBounds (row.removeFromLeft (200));
+        row.removeFromLeft (10);
+        kitFadeBox.setBounds (row.removeFromLeft (120));
+    }
 
     area.removeFromTop (10);
 
-    prevCCLabel.setBounds (area.removeFromTop (22));
+    prefetchLabel.setBounds (area.removeFromTop (22));
     {
         auto row = area.removeFromTop (28);
-        prevCCBox.setBounds (row.removeFromLeft (200));
+        prefetchToggle.setBounds (row.removeFromLeft (250));
+        row.removeFromLeft (10);
+        prefetchDepthBox.setBounds (row.removeFromLeft (120));
         row.removeFromLeft (8);
-        prevLearnButton.setBounds (row.removeFromLeft (90));
+        prefetchBudgetBox.setBounds (row.removeFromLeft (100));
     }
 
     area.removeFromTop (10);
 
-    nextCCLabel.setBounds (area.removeFromTop (22));
+    // Prev and next side by side
     {
+        auto labelRow = area.removeFromTop (22);
+        prevCCLabel.setBounds (labelRow.removeFromLeft (318));
+        nextCCLabel.setBounds (labelRow.withWidth (298));
+
         auto row = area.removeFromTop (28);
+        prevCCBox.setBounds (row.removeFromLeft (200));
+        row.removeFromLeft (8);
+        prevLearnButton.setBounds (row.removeFromLeft (90));
+        row.removeFromLeft (20);
         nextCCBox.setBounds (row.removeFromLeft (200));
         row.removeFromLeft (8);
         nextLearnButton.setBounds (row.removeFromLeft (90));
     }
 
     area.removeFromTop (20);
-    savePresetButton.setBounds (area.removeFromTop (32).withWidth (160));
+    {
+        auto row = area.removeFromTop (32);
+        savePresetButton.setBounds (row.removeFromLeft (160));
+        row.removeFromLeft (20);
+        setlistToggle.setBounds (row.removeFromLeft (130));
+        setlistInfoLabel.setBounds (row.removeFromLeft (300));
+    }
 }
 
 //==============================================================================
@@ -524,20 +665,12 @@ BeatwerkEditor::BeatwerkEditor (BeatwerkProcessor& p)
     setLookAndFeel (&darkLnf);
     setOpaque (true);
 
-    prevButton.onClick = [this]
-    {
-        processorRef.getPresetManager().loadPreviousPreset();
-        updatePresetLabel();
-        refreshPads();
-    };
+    // The label and pads update from presetLoaded() once the navigator has
+    // loaded the preset
+    prevButton.onClick = [this] { processorRef.getPresetNavigator().step (-1); };
     addAndMakeVisible (prevButton);
 
-    nextButton.onClick = [this]
-    {
-        processorRef.getPresetManager().loadNextPreset();
-        updatePresetLabel();
-        refreshPads();
-    };
+    nextButton.onClick = [this] { processorRef.getPresetNavigator().step (1); };
     addAndMakeVisible (nextButton);
 
     presetLabel.setFont (juce::FontOptions (16.0f, juce::Font::bold));
@@ -555,7 +688,8 @@ BeatwerkEditor::BeatwerkEditor (BeatwerkProcessor& p)
     settingsButton.onClick = [this] { showSettings(); };
     addAndMakeVisible (settingsButton);
 
-    sampleBrowser = std::make_unique<SampleBrowserComponent> (processorRef.getSampleEngine());
+    sampleBrowser = std::make_unique<SampleBrowserComponent> (processorRef.getSampleEngine(),
+                                                              processorRef.getSampleIndex());
     sampleBrowser->setSamplesDirectory (processorRef.getSamplesPath());
     sampleBrowser->setVisible (false);
     addAndMakeVisible (sampleBrowser.get());
@@ -564,9 +698,7 @@ BeatwerkEditor::BeatwerkEditor (BeatwerkProcessor& p)
     presetListComponent->setVisible (false);
     presetListComponent->onPresetSelected = [this] (int index)
     {
-        processorRef.getPresetManager().loadPreset (index);
-        updatePresetLabel();
-        refreshPads();
+        processorRef.getPresetNavigator().jumpTo (index);
     };
     presetListComponent->onPresetDeleted = [this] (int index)
     {
@@ -650,32 +782,11 @@ BeatwerkEditor::BeatwerkEditor (BeatwerkProcessor& p)
 
     rebuildPadGrid();
 
-    processorRef.onMidiTrigger = [this] (int midiNote, float velocity)
-    {
-        juce::MessageManager::callAsync ([this, midiNote, velocity]
-        {
-            for (auto* pad : padComponents)
-            {
-                if (pad->getMidiNote() == midiNote)
-                {
-                    pad->triggerFlash (velocity);
-                    break;
-                }
-            }
-        });
-    };
+    // Whatever queued up while no editor was open is stale
+    processorRef.getUiEvents().drain ([] (const UiEventQueue::Event&) {});
+    startTimerHz (60);
 
-    processorRef.getPresetManager().onPresetLoaded = [this] (const DkitPreset& kit)
-    {
-        processorRef.loadKitSamples (kit);
-        juce::MessageManager::callAsync ([this]
-        {
-            updatePresetLabel();
-            refreshPads();
-            if (presetListComponent != nullptr)
-                presetListComponent->setActivePreset (processorRef.getPresetManager().getCurrentPresetIndex());
-        });
-    };
+    processorRef.addListener (this);
 
     processorRef.onKitChanged = [this]
     {
@@ -697,11 +808,36 @@ BeatwerkEditor::BeatwerkEditor (BeatwerkProcessor& p)
 
 BeatwerkEditor::~BeatwerkEditor()
 {
-    processorRef.onMidiTrigger = nullptr;
     processorRef.onKitChanged = nullptr;
+    processorRef.removeListener (this);
     setLookAndFeel (nullptr);
 }
 
+void BeatwerkEditor::presetLoaded()
+{
+    updatePresetLabel();
+    refreshPads();
+    if (presetListComponent != nullptr)
+        presetListComponent->setActivePreset (processorRef.getPresetManager().getCurrentPresetIndex());
+}
+
+void BeatwerkEditor::kitLoaded()
+{
+    refreshPads();
+}
+
+void BeatwerkEditor::presetsChanged()
+{
+    if (presetListComponent != nullptr)
+        presetListComponent->refreshPresetList();
+}
+
+void BeatwerkEditor::samplesChanged (const DirectoryWatcher::ChangeSet& changes)
+{
+    if (sampleBrowser != nullptr)
+        sampleBrowser->applyChanges (changes);
+}
+
 void BeatwerkEditor::paint (juce::Graphics& g)
 {
     g.fillAll (DarkLookAndFeel::bgDark);
@@ -766,9 +902,42 @@ void BeatwerkEditor::refreshPads()
         pad->updateSampleDisplay();
 }
 
+void BeatwerkEditor::timerCallback()
+{
+    processorRef.getUiEvents().drain ([this] (const UiEventQueue::Event& event) { handleUiEvent (event); });
+
+    // Navigation that ended up where it started loads nothing
+    if (navigationPendingSinceMs > 0.0 && juce::Time::getMillisecondCounterHiRes() - navigationPendingSinceMs > 500.0)
+        updatePresetLabel();
+}
+
+void BeatwerkEditor::handleUiEvent (const UiEventQueue::Event& event)
+{
+    switch (event.type)
+    {
+        case UiEventQueue::Event::Type::trigger:
+            if (auto* pad = padsByNote[(size_t) juce::jlimit (0, 127, event.value)])
+                pad->triggerFlash (event.velocity);
+            break;
+
+        case UiEventQueue::Event::Type::navigate:
+        case UiEventQueue::Event::Type::programChange:
+            // Dimmed until presetLoaded() refreshes the label
+            presetLabel.setColour (juce::Label::textColourId, DarkLookAndFeel::textDim);
+            navigationPendingSinceMs = event.timeMs;
+            break;
+
+        case UiEventQueue::Event::Type::learn:
+            if (settingsOverlay != nullptr)
+                settingsOverlay->handleLearnComplete ((MidiMapper::LearnTarget) event.target, event.value);
+            break;
+    }
+}
+
 void BeatwerkEditor::rebuildPadGrid()
 {
     padComponents.clear (true);
+    padsByNote.fill (nullptr);
 
     for (auto& padInfo : processorRef.getMidiMapper().getAllPads())
     {
@@ -800,11 +969,17 @@ void BeatwerkEditor::rebuildPadGrid()
         pad->setVisible (! showingPresetList);
         addAndMakeVisible (pad);
         padComponents.add (pad);
+
+        if (juce::isPositiveAndBelow (padInfo.midiNote, (int) padsByNote.size()))
+            padsByNote[(size_t) padInfo.midiNote] = pad;
     }
 }
 
 void BeatwerkEditor::updatePresetLabel()
 {
+    presetLabel.setColour (juce::Label::textColourId, DarkLookAndFeel::textBright);
+    navigationPendingSinceMs = 0.0;
+
     auto& pm = processorRef.getPresetManager();
     int idx = pm.getCurrentPresetIndex();
     if (idx >= 0 && idx < pm.getNumPresets())
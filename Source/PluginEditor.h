@@ -7,7 +7,8 @@
 #include "SampleBrowserComponent.h"
 #include "LookAndFeel.h"
 
-class SettingsOverlay : public juce::Component
+class SettingsOverlay : public juce::Component,
+                        private juce::Timer
 {
 public:
     SettingsOverlay (BeatwerkProcessor& proc);
@@ -17,6 +18,9 @@ public:
 
     std::function<void()> onClose;
 
+    // A MIDI Learn finished on the audio thread.
+    void handleLearnComplete (MidiMapper::LearnTarget target, int cc);
+
 private:
     BeatwerkProcessor& processor;
     juce::Label titleLabel;
@@ -40,9 +44,18 @@ private:
     juce::ProgressBar importProgressBar { importProgress };
     juce::Label importStatusLabel;
     bool importRunning = false;
+    std::shared_ptr<std::atomic<bool>> importCancelled;
 
     juce::Label navChannelLabel;
     juce::ComboBox navChannelBox;
+    juce::Label resampleQualityLabel;
+    juce::ComboBox resampleQualityBox;
+    juce::Label kitFadeLabel;
+    juce::ComboBox kitFadeBox;
+    juce::Label prefetchLabel;
+    juce::ToggleButton prefetchToggle { "Keep neighbouring presets loaded" };
+    juce::ComboBox prefetchDepthBox;
+    juce::ComboBox prefetchBudgetBox;
     juce::Label prevCCLabel;
     juce::ComboBox prevCCBox;
     juce::TextButton prevLearnButton { "Learn" };
@@ -50,6 +63,9 @@ private:
     juce::ComboBox nextCCBox;
     juce::TextButton nextLearnButton { "Learn" };
 
+    juce::ToggleButton setlistToggle { "Setlist mode" };
+    juce::Label setlistInfoLabel;
+
     juce::TextButton savePresetButton { "Save Preset..." };
     juce::TextButton closeButton { juce::CharPointer_UTF8 ("\xc3\x97") };
 
@@ -57,11 +73,16 @@ private:
     void populateKitBox();
     void updateKitInfoLabel();
     void updateLearnButtonStates();
+    void updateSetlistInfoLabel();
     void doAbletonImport();
+
+    void timerCallback() override { updateSetlistInfoLabel(); }
 };
 
 class BeatwerkEditor : public juce::AudioProcessorEditor,
-                             public juce::DragAndDropContainer
+                             public juce::DragAndDropContainer,
+                             private BeatwerkProcessor::Listener,
+                             private juce::Timer
 {
 public:
     BeatwerkEditor (BeatwerkProcessor&);
@@ -90,6 +111,7 @@ private:
     juce::TextButton settingsButton { "Settings" };
 
     juce::OwnedArray<PadComponent> padComponents;
+    std::array<PadComponent*, 128> padsByNote {};
 
     std::unique_ptr<SampleBrowserComponent> sampleBrowser;
     bool showingSampleBrowser = false;
@@ -105,5 +127,15 @@ private:
     void showSettings();
     void hideSettings();
 
+    // Drains the processor's UiEventQueue once per display frame
+    void timerCallback() override;
+    void handleUiEvent (const UiEventQueue::Event& event);
+    double navigationPendingSinceMs = 0.0;
+
+    void presetLoaded() override;
+    void kitLoaded() override;
+    void presetsChanged() override;
+    void samplesChanged (const DirectoryWatcher::ChangeSet& changes) override;
+
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (BeatwerkEditor)
 };
@@ -7,17 +7,74 @@ BeatwerkProcessor::BeatwerkProcessor()
 {
     presetManager.onPresetLoaded = [this] (const DkitPreset& kit)
     {
-        loadKitSamples (kit);
+        handlePresetLoaded (kit);
     };
 
-    juce::Thread::launch ([this] { presetManager.scanForPresets(); });
+    presetManager.onSetlistChanged = [this]
+    {
+        updatePrefetchTargets();
+        postUpdate (programChangePending);
+    };
+
+    kitLoader.onKitLoaded = [this]
+    {
+        postUpdate (kitLoadedPending);
+    };
+
+    // Before the host first asks for the programs; the PresetIndex makes
+    // this cheap enough to do here
+    presetManager.scanForPresets();
+
+    fileWatcher.onChanges = [this] (const DirectoryWatcher::ChangeSet& changes)
+    {
+        handleFileChanges (changes);
+    };
+    updateWatchedDirectories();
+}
+
+BeatwerkProcessor::~BeatwerkProcessor()
+{
+    cancelPendingUpdate();
 }
 
-BeatwerkProcessor::~BeatwerkProcessor() {}
+void BeatwerkProcessor::postUpdate (std::atomic<bool>& pending)
+{
+    pending.store (true);
+    triggerAsyncUpdate();
+}
+
+void BeatwerkProcessor::handleAsyncUpdate()
+{
+    if (programChangePending.exchange (false))
+        updateHostDisplay (ChangeDetails().withProgramChanged (true));
+
+    if (presetLoadedPending.exchange (false))
+        listeners.call ([] (Listener& l) { l.presetLoaded(); });
+
+    if (kitLoadedPending.exchange (false))
+        listeners.call ([] (Listener& l) { l.kitLoaded(); });
+
+    if (presetsChangedPending.exchange (false))
+        listeners.call ([] (Listener& l) { l.presetsChanged(); });
+
+    std::vector<DirectoryWatcher::ChangeSet> sampleChanges;
+    {
+        std::lock_guard<std::mutex> lock (sampleChangesMutex);
+        sampleChanges.swap (pendingSampleChanges);
+    }
+
+    for (auto& changes : sampleChanges)
+        listeners.call ([&changes] (Listener& l) { l.samplesChanged (changes); });
+}
 
 void BeatwerkProcessor::prepareToPlay (double sampleRate, int samplesPerBlock)
 {
+    bool rateChanged = sampleRate != sampleEngine.getSampleRate();
     sampleEngine.prepareToPlay (sampleRate, samplesPerBlock);
+
+    // Prefetched and pinned kits were decoded for the old rate
+    if (rateChanged)
+        updatePrefetchTargets();
 }
 
 void BeatwerkProcessor::releaseResources()
@@ -40,22 +97,33 @@ void BeatwerkProcessor::processBlock (juce::AudioBuffer<float>& buffer,
     juce::ScopedNoDenormals noDenormals;
     buffer.clear();
 
+    sampleEngine.applyPendingCommands();
+
     for (const auto metadata : midiMessages)
     {
         auto msg = metadata.getMessage();
 
-        if (midiMapper.processForLearn (msg))
+        auto learned = midiMapper.processForLearn (msg);
+        if (learned != MidiMapper::LearnTarget::None)
+        {
+            uiEvents.push ({ UiEventQueue::Event::Type::learn, msg.getControllerNumber(), (int) learned });
             continue;
+        }
 
         auto navAction = midiMapper.processForNavigation (msg);
-        if (navAction == MidiMapper::NavAction::Next)
+        if (navAction != MidiMapper::NavAction::None)
         {
-            juce::MessageManager::callAsync ([this] { presetManager.loadNextPreset(); });
+            int step = navAction == MidiMapper::NavAction::Next ? 1 : -1;
+            presetNavigator.step (step);
+            uiEvents.push ({ UiEventQueue::Event::Type::navigate, step });
             continue;
         }
-        if (navAction == MidiMapper::NavAction::Previous)
+
+        auto program = midiMapper.processForProgramChange (msg);
+        if (program >= 0)
         {
-            juce::MessageManager::callAsync ([this] { presetManager.loadPreviousPreset(); });
+            presetNavigator.selectProgram (program);
+            uiEvents.push ({ UiEventQueue::Event::Type::programChange, program });
             continue;
         }
 
@@ -63,14 +131,13 @@ void BeatwerkProcessor::processBlock (juce::AudioBuffer<float>& buffer,
         {
             int note = msg.getNoteNumber();
             float velocity = msg.getFloatVelocity();
-            sampleEngine.noteOn (note, velocity);
-
-            if (onMidiTrigger)
-                onMidiTrigger (note, velocity);
+            sampleEngine.noteOn (note, velocity, metadata.samplePosition);
+            uiEvents.push ({ UiEventQueue::Event::Type::trigger, note, 0, velocity });
         }
     }
 
-    sampleEngine.renderNextBlock (buffer, 0, buffer.getNumSamples());
+    if (! sampleEngine.isSilent())
+        sampleEngine.renderNextBlock (buffer, 0, buffer.getNumSamples());
 }
 
 juce::AudioProcessorEditor* BeatwerkProcessor::createEditor()
@@ -89,9 +156,21 @@ void BeatwerkProcessor::getStateInformation (juce::MemoryBlock& destData)
     state->setAttribute ("prevCC", midiMapper.getPrevCCNumber());
     state->setAttribute ("nextCC", midiMapper.getNextCCNumber());
 
+    state->setAttribute ("resampleQuality", (int) sampleEngine.getResampleQuality());
+    state->setAttribute ("kitFadeMs", (double) sampleEngine.getKitFadeTime());
+
+    state->setAttribute ("prefetch", kitPrefetcher.isEnabled());
+    state->setAttribute ("prefetchDepth", kitPrefetcher.getDepth());
+    state->setAttribute ("prefetchBudgetMB", (int) (kitPrefetcher.getMemoryBudget() / (1024 * 1024)));
+
     state->setAttribute ("drumKit", midiMapper.getActiveKitId());
     state->setAttribute ("presetIndex", presetManager.getCurrentPresetIndex());
 
+    auto* setlistEl = state->createNewChildElement ("Setlist");
+    setlistEl->setAttribute ("active", presetManager.isSetlistActive());
+    for (auto& presetFile : presetManager.getSetlist())
+        setlistEl->createNewChildElement ("Preset")->setAttribute ("file", presetFile.getFullPathName());
+
     auto* padsEl = state->createNewChildElement ("PadMappings");
     for (auto& pad : midiMapper.getAllPads())
     {
@@ -125,6 +204,8 @@ void BeatwerkProcessor::setStateInformation (const void* data, int sizeInBytes)
     if (presetsPath.isNotEmpty())
         presetManager.setPresetsDir (juce::File (presetsPath));
 
+    updateWatchedDirectories();
+
     auto drumKitId = state->getStringAttribute ("drumKit");
     if (drumKitId.isNotEmpty())
         midiMapper.setActiveKit (drumKitId);
@@ -136,23 +217,42 @@ void BeatwerkProcessor::setStateInformation (const void* data, int sizeInBytes)
         state->getIntAttribute ("navCC", 1)));
     midiMapper.setNextCCNumber (state->getIntAttribute ("nextCC", 2));
 
+    auto quality = juce::jlimit (0, 2, state->getIntAttribute ("resampleQuality", (int) Resampler::Quality::standard));
+    sampleEngine.setResampleQuality ((Resampler::Quality) quality);
+    sampleEngine.setKitFadeTime ((float) state->getDoubleAttribute ("kitFadeMs", 10.0));
+
+    kitPrefetcher.setDepth (state->getIntAttribute ("prefetchDepth", 1));
+    kitPrefetcher.setMemoryBudget ((juce::int64) state->getIntAttribute ("prefetchBudgetMB", 1024) * 1024 * 1024);
+    kitPrefetcher.setEnabled (state->getBoolAttribute ("prefetch", false));
+
+    if (auto* setlistEl = state->getChildByName ("Setlist"))
+    {
+        std::vector<juce::File> setlist;
+        for (auto* presetEl : setlistEl->getChildWithTagNameIterator ("Preset"))
+            setlist.push_back (juce::File (presetEl->getStringAttribute ("file")));
+
+        presetManager.setSetlist (std::move (setlist));
+        presetManager.setSetlistActive (setlistEl->getBoolAttribute ("active", false));
+    }
+
     auto* padsEl = state->getChildByName ("PadMappings");
     if (padsEl != nullptr)
     {
+        std::vector<KitLoader::PadRequest> requests;
+        std::map<int, float> volumes;
+
         for (auto* padEl : padsEl->getChildIterator())
         {
             int note = padEl->getIntAttribute ("note", -1);
             auto filePath = padEl->getStringAttribute ("file");
             if (note >= 0 && filePath.isNotEmpty())
-            {
-                juce::File file (filePath);
-                if (file.existsAsFile())
-                    sampleEngine.loadSample (note, file);
-            }
+                requests.push_back ({ note, juce::File (filePath), {} });
 
             if (note >= 0 && padEl->hasAttribute ("volume"))
-                sampleEngine.setPadVolume (note, (float) padEl->getDoubleAttribute ("volume", 1.0));
+                volumes[note] = (float) padEl->getDoubleAttribute ("volume", 1.0);
         }
+
+        kitLoader.loadKit (requests, volumes);
     }
 
     int presetIdx = state->getIntAttribute ("presetIndex", -1);
@@ -166,46 +266,146 @@ void BeatwerkProcessor::setStateInformation (const void* data, int sizeInBytes)
     }
 }
 
+int BeatwerkProcessor::getNumPrograms()
+{
+    // Hosts expect at least one
+    return juce::jmax (1, presetManager.getNumPrograms());
+}
+
+int BeatwerkProcessor::getCurrentProgram()
+{
+    return juce::jmax (0, presetManager.getProgramForPresetIndex (presetManager.getCurrentPresetIndex()));
+}
+
+void BeatwerkProcessor::setCurrentProgram (int index)
+{
+    presetNavigator.selectProgram (index);
+}
+
+const juce::String BeatwerkProcessor::getProgramName (int index)
+{
+    return presetManager.getPresetName (presetManager.getPresetIndexForProgram (index));
+}
+
+void BeatwerkProcessor::handlePresetLoaded (const DkitPreset& kit)
+{
+    loadKitSamples (kit);
+    programChangePending.store (true);
+    postUpdate (presetLoadedPending);
+}
+
 void BeatwerkProcessor::loadKitSamples (const DkitPreset& kit)
 {
-    sampleEngine.clearAllSamples();
+    std::map<int, float> volumes;
+    auto requests = makePadRequests (kit, volumes);
+    kitLoader.loadKit (requests, volumes);
+
+    updatePrefetchTargets();
+}
 
+std::vector<KitLoader::PadRequest> BeatwerkProcessor::makePadRequests (const DkitPreset& kit,
+                                                                      std::map<int, float>& volumes) const
+{
     auto presetId = PadMappingManager::makePresetId (kit.sourceFile);
     auto customMapping = padMappingManager.loadMapping (presetId);
 
-    if (customMapping.has_value())
+    if (! customMapping.has_value())
+        return makeDefaultPadRequests (kit);
+
+    std::vector<KitLoader::PadRequest> requests;
+    for (auto& [note, file] : customMapping->pads)
+        requests.push_back ({ note, file, {} });
+
+    volumes = customMapping->volumes;
+    return requests;
+}
+
+void BeatwerkProcessor::updatePrefetchTargets()
+{
+    std::vector<juce::File> neighbours;
+
+    const int numPresets = presetManager.getNumPresets();
+    const int current = presetManager.getCurrentPresetIndex();
+
+    if (kitPrefetcher.isEnabled() && current >= 0 && numPresets > 1)
     {
-        for (auto& [note, file] : customMapping->pads)
+        // Nearest first, alternating next and previous, following navigation
+        // into the setlist or around the ends
+        for (int distance = 1; distance <= kitPrefetcher.getDepth(); ++distance)
         {
-            if (file.existsAsFile())
-                sampleEngine.loadSample (note, file);
-        }
+            for (int steps : { distance, -distance })
+            {
+                int index = presetManager.getNeighbourIndex (current, steps);
+                auto file = presetManager.getPresetFile (index);
 
-        for (auto& [note, vol] : customMapping->volumes)
-            sampleEngine.setPadVolume (note, vol);
+                if (index != current && std::find (neighbours.begin(), neighbours.end(), file) == neighbours.end())
+                    neighbours.push_back (file);
+            }
+        }
     }
-    else
+
+    kitPrefetcher.retarget (std::move (neighbours));
+    kitPrefetcher.pin (presetManager.isSetlistActive() ? presetManager.getSetlist() : std::vector<juce::File>());
+}
+
+std::vector<KitLoader::PadRequest> BeatwerkProcessor::makeDefaultPadRequests (const DkitPreset& kit) const
+{
+    std::vector<KitLoader::PadRequest> requests;
+
+    for (auto& pad : kit.pads)
     {
-        for (auto& pad : kit.pads)
-        {
-            auto sampleFile = presetManager.resolveSamplePath (pad.sampleFile);
-            if (sampleFile.existsAsFile())
-                sampleEngine.loadSample (pad.midiNote, sampleFile);
-            else if (pad.sampleFile.isNotEmpty())
-                sampleEngine.markSampleMissing (pad.midiNote, pad.sampleName);
-        }
+        KitLoader::PadRequest request;
+        request.midiNote = pad.midiNote;
+        request.file = presetManager.resolveSamplePath (pad.sampleFile);
+        if (pad.sampleFile.isNotEmpty())
+            request.missingName = pad.sampleName;
+        requests.push_back (request);
     }
+
+    return requests;
 }
 
 void BeatwerkProcessor::setSamplesPath (const juce::File& path)
 {
     presetManager.setSamplesDir (path);
+    updateWatchedDirectories();
 }
 
 void BeatwerkProcessor::setPresetsPath (const juce::File& path)
 {
     presetManager.setPresetsDir (path);
     presetManager.scanForPresets();
+    updateWatchedDirectories();
+}
+
+void BeatwerkProcessor::updateWatchedDirectories()
+{
+    fileWatcher.setDirectories ({ presetManager.getPresetsDir(), presetManager.getSamplesDir() });
+    sampleIndex.setRoot (presetManager.getSamplesDir());
+}
+
+// On the DirectoryWatcher's thread; the host and listeners hear about it
+// from handleAsyncUpdate
+void BeatwerkProcessor::handleFileChanges (const DirectoryWatcher::ChangeSet& changes)
+{
+    if (changes.root == presetManager.getPresetsDir() && presetManager.applyFileChanges (changes))
+    {
+        updatePrefetchTargets();
+        programChangePending.store (true);
+        postUpdate (presetsChangedPending);
+    }
+
+    if (changes.root == presetManager.getSamplesDir())
+    {
+        sampleIndex.applyChanges (changes);
+
+        {
+            std::lock_guard<std::mutex> lock (sampleChangesMutex);
+            pendingSampleChanges.push_back (changes);
+        }
+
+        triggerAsyncUpdate();
+    }
 }
 
 void BeatwerkProcessor::swapPadsAndSave (int noteA, int noteB)
@@ -216,7 +416,7 @@ void BeatwerkProcessor::swapPadsAndSave (int noteA, int noteB)
 
 void BeatwerkProcessor::saveCurrentMappingOverlay()
 {
-    auto& kit = presetManager.getCurrentKit();
+    auto kit = presetManager.getCurrentKit();
     if (kit.sourceFile == juce::File())
         return;
 
@@ -240,25 +440,14 @@ void BeatwerkProcessor::saveCurrentMappingOverlay()
 
 void BeatwerkProcessor::resetCurrentMappingToDefault()
 {
-    auto& kit = presetManager.getCurrentKit();
+    auto kit = presetManager.getCurrentKit();
     if (kit.sourceFile == juce::File())
         return;
 
     auto presetId = PadMappingManager::makePresetId (kit.sourceFile);
     padMappingManager.clearMapping (presetId);
 
-    sampleEngine.clearAllSamples();
-    for (auto& pad : kit.pads)
-    {
-        auto sampleFile = presetManager.resolveSamplePath (pad.sampleFile);
-        if (sampleFile.existsAsFile())
-            sampleEngine.loadSample (pad.midiNote, sampleFile);
-        else if (pad.sampleFile.isNotEmpty())
-            sampleEngine.markSampleMissing (pad.midiNote, pad.sampleName);
-    }
-
-    for (auto& pad : midiMapper.getAllPads())
-        sampleEngine.setPadVolume (pad.midiNote, 1.0f);
+    kitLoader.loadKit (makeDefaultPadRequests (kit));
 }
 
 void BeatwerkProcessor::setActiveKit (const juce::String& kitId)
@@ -5,8 +5,14 @@
 #include "AdgParser.h"
 #include "PresetManager.h"
 #include "PadMappingManager.h"
-
-class BeatwerkProcessor : public juce::AudioProcessor
+#include "KitLoader.h"
+#include "KitPrefetcher.h"
+#include "PresetNavigator.h"
+#include "SampleIndex.h"
+#include "UiEventQueue.h"
+
+class BeatwerkProcessor : public juce::AudioProcessor,
+                          private juce::AsyncUpdater
 {
 public:
     BeatwerkProcessor();
@@ -29,10 +35,17 @@ public:
     bool isMidiEffect() const override { return false; }
     double getTailLengthSeconds() const override { return 0.0; }
 
-    int getNumPrograms() override { return 1; }
-    int getCurrentProgram() override { return 0; }
-    void setCurrentProgram (int) override {}
-    const juce::String getProgramName (int) override { return {}; }
+    // Programs are the presets, or the setlist while it is active. Switching
+    // goes through the PresetNavigator, so it never blocks the caller.
+    //
+    // The VST3 wrapper reads getNumPrograms() once, when the plugin is
+    // instantiated, and only exposes a program list if it is above one. A
+    // count that changes later, from a rescan or the setlist being toggled,
+    // isn't picked up by VST3 hosts until the plugin is loaded again.
+    int getNumPrograms() override;
+    int getCurrentProgram() override;
+    void setCurrentProgram (int index) override;
+    const juce::String getProgramName (int index) override;
     void changeProgramName (int, const juce::String&) override {}
 
     void getStateInformation (juce::MemoryBlock& destData) override;
@@ -43,11 +56,40 @@ public:
     AdgParser& getAdgParser() { return adgParser; }
     PresetManager& getPresetManager() { return presetManager; }
     PadMappingManager& getPadMappingManager() { return padMappingManager; }
-
-    std::function<void (int midiNote, float velocity)> onMidiTrigger;
-
+    KitLoader& getKitLoader() { return kitLoader; }
+    KitPrefetcher& getKitPrefetcher() { return kitPrefetcher; }
+    PresetNavigator& getPresetNavigator() { return presetNavigator; }
+    SampleIndex& getSampleIndex() { return sampleIndex; }
+
+    // Hits, navigation and MIDI Learn results for the editor to drain.
+    UiEventQueue& getUiEvents() { return uiEvents; }
+
+    // Notified on the message thread, whichever thread the change happened
+    // on. Add and remove only on the message thread.
+    struct Listener
+    {
+        virtual ~Listener() = default;
+        virtual void presetLoaded() {}
+        virtual void kitLoaded() {}
+
+        // File changes under the presets and samples directories. The preset
+        // list and sample index are already patched when these are called.
+        virtual void presetsChanged() {}
+        virtual void samplesChanged (const DirectoryWatcher::ChangeSet&) {}
+    };
+
+    void addListener (Listener* listener) { listeners.add (listener); }
+    void removeListener (Listener* listener) { listeners.remove (listener); }
+
+    // Loads the kit's samples and tells the host the program changed. Called
+    // from PresetManager::onPresetLoaded, possibly on the navigator's thread.
+    void handlePresetLoaded (const DkitPreset& kit);
     void loadKitSamples (const DkitPreset& kit);
 
+    // Points the prefetcher at the presets around the current one, and pins
+    // the setlist while it is active. Call after changing its settings.
+    void updatePrefetchTargets();
+
     void swapPadsAndSave (int noteA, int noteB);
     void saveCurrentMappingOverlay();
     void resetCurrentMappingToDefault();
@@ -67,6 +109,37 @@ private:
     AdgParser adgParser;
     PresetManager presetManager;
     PadMappingManager padMappingManager;
+    UiEventQueue uiEvents;
+
+    // Declared before the threads below, which post to them until they stop
+    juce::ListenerList<Listener> listeners;
+    std::atomic<bool> presetLoadedPending { false };
+    std::atomic<bool> kitLoadedPending { false };
+    std::atomic<bool> programChangePending { false };
+    std::atomic<bool> presetsChangedPending { false };
+
+    std::mutex sampleChangesMutex;
+    std::vector<DirectoryWatcher::ChangeSet> pendingSampleChanges;
+
+    KitLoader kitLoader { sampleEngine };
+    KitPrefetcher kitPrefetcher { sampleEngine, presetManager, [this] (const DkitPreset& kit)
+    {
+        std::map<int, float> volumes;
+        return makePadRequests (kit, volumes);
+    } };
+    SampleIndex sampleIndex;
+    DirectoryWatcher fileWatcher;
+    PresetNavigator presetNavigator { presetManager };
+
+    // Sets the flag and has handleAsyncUpdate act on it on the message thread
+    void postUpdate (std::atomic<bool>& pending);
+    void handleAsyncUpdate() override;
+
+    void updateWatchedDirectories();
+    void handleFileChanges (const DirectoryWatcher::ChangeSet& changes);
+
+    std::vector<KitLoader::PadRequest> makePadRequests (const DkitPreset& kit, std::map<int, float>& volumes) const;
+    std::vector<KitLoader::PadRequest> makeDefaultPadRequests (const DkitPreset& kit) const;
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (BeatwerkProcessor)
 };
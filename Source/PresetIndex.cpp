@@ -0,0 +1,292 @@
+#include "PresetIndex.h"
+#include "PresetManager.h"
+#include <cstring>
+
+namespace
+{
+    constexpr char kMagic[4] = { 'B', 'W', 'P', 'I' };
+    constexpr int kVersion = 1;
+}
+
+PresetIndex::PresetIndex()
+{
+    auto appData = juce::File::getSpecialLocation (juce::File::userApplicationDataDirectory);
+    directory = appData.getChildFile ("Beatwerk/PresetIndex");
+}
+
+std::vector<juce::File> PresetIndex::refresh (const juce::File& presetsDir)
+{
+    std::lock_guard<std::mutex> refreshLock (refreshMutex);
+
+    EntryMap previous;
+    bool dirChanged;
+    {
+        std::lock_guard<std::mutex> lock (mutex);
+        dirChanged = presetsDir != indexedDir;
+        if (! dirChanged)
+            previous = entries;
+    }
+
+    if (dirChanged)
+        previous = load (presetsDir);
+
+    std::vector<juce::File> files;
+    EntryMap current;
+    size_t reused = 0;
+
+    if (presetsDir.isDirectory())
+    {
+        for (const auto& found : juce::RangedDirectoryIterator (presetsDir, true, "*.dkit", juce::File::findFiles))
+        {
+            auto file = found.getFile();
+            auto size = found.getFileSize();
+            auto modificationTime = found.getModificationTime().toMilliseconds();
+            auto& entry = current[file.getFullPathName()];
+
+            auto existing = previous.find (file.getFullPathName());
+            if (existing != previous.end()
+                && existing->second->size == size
+                && existing->second->modificationTime == modificationTime)
+            {
+                entry = existing->second;
+                ++reused;
+            }
+            else
+            {
+                entry = makeEntry (file, size, modificationTime);
+            }
+
+            files.push_back (file);
+        }
+    }
+
+    bool needsSave = reused != current.size() || reused != previous.size();
+    {
+        std::lock_guard<std::mutex> lock (mutex);
+        needsSave = needsSave || (unsaved && ! dirChanged);
+        indexedDir = presetsDir;
+        entries = current;
+        unsaved = false;
+    }
+
+    if (needsSave)
+        save (presetsDir, current);
+
+    return files;
+}
+
+void PresetIndex::update (const std::vector<juce::File>& changed, const std::vector<juce::File>& removed)
+{
+    std::lock_guard<std::mutex> refreshLock (refreshMutex);
+
+    std::vector<std::pair<juce::String, std::shared_ptr<const Entry>>> parsed;
+    for (auto& file : changed)
+        if (file.existsAsFile())
+            parsed.emplace_back (file.getFullPathName(),
+                                 makeEntry (file, file.getSize(), file.getLastModificationTime().toMilliseconds()));
+
+    EntryMap toSave;
+    juce::File dir;
+    {
+        std::lock_guard<std::mutex> lock (mutex);
+        if (indexedDir == juce::File())
+            return;
+
+        for (auto& file : removed)
+        {
+            entries.erase (file.getFullPathName());
+
+            auto prefix = file.getFullPathName() + juce::File::getSeparatorString();
+            for (auto it = entries.lower_bound (prefix); it != entries.end() && it->first.startsWith (prefix);)
+                it = entries.erase (it);
+        }
+
+        for (auto& [path, entry] : parsed)
+            if (juce::File (path).isAChildOf (indexedDir))
+                entries[path] = entry;
+
+        unsaved = false;
+        toSave = entries;
+        dir = indexedDir;
+    }
+
+    save (dir, toSave);
+}
+
+DkitPreset PresetIndex::read (const juce::File& presetFile)
+{
+    auto key = presetFile.getFullPathName();
+    auto size = presetFile.getSize();
+    auto modificationTime = presetFile.getLastModificationTime().toMilliseconds();
+
+    std::shared_ptr<const Entry> entry;
+    {
+        std::lock_guard<std::mutex> lock (mutex);
+        auto existing = entries.find (key);
+        if (existing != entries.end()
+            && existing->second->size == size
+            && existing->second->modificationTime == modificationTime)
+            entry = existing->second;
+    }
+
+    if (entry == nullptr)
+    {
+        entry = makeEntry (presetFile, size, modificationTime);
+
+        // Kept only for the indexed directory; anything else is re-read next time
+        std::lock_guard<std::mutex> lock (mutex);
+        if (presetFile.isAChildOf (indexedDir))
+        {
+            entries[key] = entry;
+            unsaved = true;
+        }
+    }
+
+    DkitPreset preset;
+    if (decode (entry->kit, preset))
+        preset.sourceFile = presetFile;
+
+    return preset;
+}
+
+std::shared_ptr<const PresetIndex::Entry> PresetIndex::makeEntry (const juce::File& file, juce::int64 size,
+                                                                  juce::int64 modificationTime)
+{
+    auto entry = std::make_shared<Entry>();
+    entry->size = size;
+    entry->modificationTime = modificationTime;
+
+    auto preset = PresetManager::parseDkitJson (file);
+    if (preset.name.isNotEmpty())
+        entry->kit = encode (preset);
+
+    return entry;
+}
+
+//==============================================================================
+juce::MemoryBlock PresetIndex::encode (const DkitPreset& preset)
+{
+    juce::MemoryOutputStream out;
+    out.writeString (preset.name);
+    out.writeString (preset.author);
+    out.writeString (preset.description);
+    out.writeString (preset.source);
+    out.writeString (preset.createdAt);
+    out.writeCompressedInt ((int) preset.pads.size());
+
+    for (auto& pad : preset.pads)
+    {
+        out.writeCompressedInt (pad.midiNote);
+        out.writeString (pad.sampleFile);
+        out.writeString (pad.sampleName);
+    }
+
+    return out.getMemoryBlock();
+}
+
+bool PresetIndex::decode (const juce::MemoryBlock& data, DkitPreset& preset)
+{
+    if (data.isEmpty())
+        return false;
+
+    juce::MemoryInputStream in (data, false);
+    preset.name = in.readString();
+    preset.author = in.readString();
+    preset.description = in.readString();
+    preset.source = in.readString();
+    preset.createdAt = in.readString();
+
+    // No limit of its own, since parseDkitJson has none; a pad takes at least
+    // three bytes, which catches a corrupt count before allocating for it
+    auto numPads = in.readCompressedInt();
+    if (numPads < 0 || numPads > in.getNumBytesRemaining() / 3)
+        return false;
+
+    preset.pads.resize ((size_t) numPads);
+    for (auto& pad : preset.pads)
+    {
+        pad.midiNote = in.readCompressedInt();
+        pad.sampleFile = in.readString();
+        pad.sampleName = in.readString();
+    }
+
+    return in.getPosition() == (juce::int64) data.getSize();
+}
+
+//==============================================================================
+juce::File PresetIndex::getIndexFileFor (const juce::File& presetsDir) const
+{
+    auto hash = presetsDir.getFullPathName().hashCode64();
+    return directory.getChildFile (juce::String::toHexString (hash) + ".bwpi");
+}
+
+PresetIndex::EntryMap PresetIndex::load (const juce::File& presetsDir) const
+{
+    EntryMap loaded;
+
+    juce::MemoryBlock data;
+    if (! getIndexFileFor (presetsDir).loadFileAsData (data))
+        return loaded;
+
+    juce::MemoryInputStream in (data, false);
+
+    char magic[4] = {};
+    in.read (magic, sizeof (magic));
+    if (std::memcmp (magic, kMagic, sizeof (kMagic)) != 0
+        || in.readInt() != kVersion
+        || in.readString() != presetsDir.getFullPathName())
+        return loaded;
+
+    auto numEntries = in.readInt();
+
+    for (int i = 0; i < numEntries && ! in.isExhausted(); ++i)
+    {
+        auto relativePath = in.readString();
+        auto entry = std::make_shared<Entry>();
+        entry->size = in.readInt64();
+        entry->modificationTime = in.readInt64();
+
+        auto kitSize = in.readCompressedInt();
+        if (kitSize < 0 || kitSize > in.getNumBytesRemaining())
+            return {};
+
+        in.readIntoMemoryBlock (entry->kit, kitSize);
+        loaded[presetsDir.getChildFile (relativePath).getFullPathName()] = std::move (entry);
+    }
+
+    return loaded;
+}
+
+void PresetIndex::save (const juce::File& presetsDir, const EntryMap& toSave) const
+{
+    if (! directory.createDirectory())
+        return;
+
+    // Written under a temporary name, so a reader never loads a partial index
+    juce::TemporaryFile temp (getIndexFileFor (presetsDir));
+    {
+        juce::FileOutputStream out (temp.getFile());
+        if (! out.openedOk())
+            return;
+
+        out.write (kMagic, sizeof (kMagic));
+        out.writeInt (kVersion);
+        out.writeString (presetsDir.getFullPathName());
+        out.writeInt ((int) toSave.size());
+
+        for (auto& [path, entry] : toSave)
+        {
+            out.writeString (juce::File (path).getRelativePathFrom (presetsDir));
+            out.writeInt64 (entry->size);
+            out.writeInt64 (entry->modificationTime);
+            out.writeCompressedInt ((int) entry->kit.getSize());
+            out.write (entry->kit.getData(), entry->kit.getSize());
+        }
+
+        out.flush();
+        if (out.getStatus().failed())
+            return;
+    }
+
+    temp.overwriteTargetFileWithTemporary();
+}
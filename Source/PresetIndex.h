@@ -0,0 +1,65 @@
+#pragma once
+#include <juce_core/juce_core.h>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+struct DkitPreset;
+
+// On-disk index of the .dkit presets under a directory, so that rescans
+// and preset loads don't have to parse JSON.
+//
+// Each preset is kept pre-parsed in a compact binary form, together with
+// the file's size and modification time. refresh() lists the directory and
+// re-parses only files that are new or whose size or time changed; the
+// index is saved whenever anything did. There is one index file per presets
+// directory, in Beatwerk/PresetIndex.
+//
+// Thread-safe.
+class PresetIndex
+{
+public:
+    PresetIndex();
+
+    // Brings the index in line with the presets under presetsDir and returns
+    // their files, in no particular order.
+    std::vector<juce::File> refresh (const juce::File& presetsDir);
+
+    // Re-indexes the changed files and drops the removed ones, along with
+    // everything under any removed directory, without listing the presets
+    // directory. Removals apply first.
+    void update (const std::vector<juce::File>& changed, const std::vector<juce::File>& removed);
+
+    // The preset as indexed, or parsed from the file if it isn't indexed yet
+    // or has changed since. An empty name means it couldn't be read.
+    DkitPreset read (const juce::File& presetFile);
+
+private:
+    struct Entry
+    {
+        juce::int64 size = 0;
+        juce::int64 modificationTime = 0;
+        juce::MemoryBlock kit;      // see encode(); empty if the file didn't parse
+    };
+
+    using EntryMap = std::map<juce::String, std::shared_ptr<const Entry>>;   // by full path
+
+    juce::File directory;
+
+    std::mutex mutex;
+    juce::File indexedDir;
+    EntryMap entries;
+    bool unsaved = false;       // read() indexed something since the last save
+
+    std::mutex refreshMutex;    // one refresh at a time
+
+    juce::File getIndexFileFor (const juce::File& presetsDir) const;
+    EntryMap load (const juce::File& presetsDir) const;
+    void save (const juce::File& presetsDir, const EntryMap& toSave) const;
+
+    static std::shared_ptr<const Entry> makeEntry (const juce::File& file, juce::int64 size,
+                                                   juce::int64 modificationTime);
+    static juce::MemoryBlock encode (const DkitPreset& preset);
+    static bool decode (const juce::MemoryBlock& data, DkitPreset& preset);
+};
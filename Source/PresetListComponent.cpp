@@ -33,6 +33,18 @@ void PresetListContent::paint (juce::Graphics& g)
         }
 
         auto textBounds = juce::Rectangle<int> (12, i * rowHeight, width - 24, rowHeight);
+
+        int setlistPosition = i < (int) setlistPositions.size() ? setlistPositions[(size_t) i] : -1;
+        if (setlistPosition >= 0)
+        {
+            auto badge = textBounds.removeFromRight (36).withSizeKeepingCentre (36, 20);
+            g.setColour (DarkLookAndFeel::accent);
+            g.drawRoundedRectangle (badge.toFloat(), 4.0f, 1.0f);
+            g.setFont (juce::FontOptions (12.0f, juce::Font::bold));
+            g.drawText ("S" + juce::String (setlistPosition + 1), badge, juce::Justification::centred, false);
+            g.setColour (i == activeIndex ? DarkLookAndFeel::textBright : DarkLookAndFeel::textDim);
+        }
+
         g.setFont (juce::FontOptions (15.0f));
         g.drawText (juce::String (i + 1) + ".  " + presetNames[i],
                     textBounds, juce::Justification::centredLeft, true);
@@ -57,9 +69,23 @@ void PresetListContent::mouseDown (const juce::MouseEvent& e)
 
 void PresetListContent::showContextMenu (int rowIndex)
 {
+    bool inSetlist = rowIndex < (int) setlistPositions.size() && setlistPositions[(size_t) rowIndex] >= 0;
+
     juce::PopupMenu menu;
     menu.addItem (1, "Rename...");
     menu.addItem (2, "Delete");
+    menu.addSeparator();
+
+    if (inSetlist)
+    {
+        menu.addItem (4, "Remove from Setlist");
+        menu.addItem (5, "Move Earlier in Setlist");
+        menu.addItem (6, "Move Later in Setlist");
+    }
+    else
+    {
+        menu.addItem (3, "Add to Setlist");
+    }
 
     menu.showMenuAsync (juce::PopupMenu::Options(),
         [this, rowIndex] (int result)
@@ -68,6 +94,8 @@ void PresetListContent::showContextMenu (int rowIndex)
                 showRenameDialog (rowIndex);
             else if (result == 2)
                 showDeleteConfirmation (rowIndex);
+            else if (result >= 3 && result <= 6 && onSetlistEditRequested)
+                onSetlistEditRequested (rowIndex, (SetlistEdit) (result - 3));
         });
 }
 
@@ -130,6 +158,12 @@ void PresetListContent::setPresetNames (const juce::StringArray& names)
     repaint();
 }
 
+void PresetListContent::setSetlistPositions (std::vector<int> positions)
+{
+    setlistPositions = std::move (positions);
+    repaint();
+}
+
 void PresetListContent::setActiveIndex (int index)
 {
     activeIndex = index;
@@ -234,6 +268,19 @@ PresetListComponent::PresetListComponent (PresetManager& pm) : presetManager (pm
             onPresetRenamed (index, newName);
     };
 
+    listContent.onSetlistEditRequested = [this] (int index, PresetListContent::SetlistEdit edit)
+    {
+        switch (edit)
+        {
+            case PresetListContent::SetlistEdit::add:         presetManager.addToSetlist (index); break;
+            case PresetListContent::SetlistEdit::remove:      presetManager.removeFromSetlist (index); break;
+            case PresetListContent::SetlistEdit::moveEarlier: presetManager.moveInSetlist (index, -1); break;
+            case PresetListContent::SetlistEdit::moveLater:   presetManager.moveInSetlist (index, 1); break;
+        }
+
+        refreshSetlistPositions();
+    };
+
     upButton.onClick = [this] { scrollPageUp(); };
     addAndMakeVisible (upButton);
 
@@ -277,10 +324,20 @@ void PresetListComponent::refreshPresetList()
         names.add (presetManager.getPresetName (i));
 
     listContent.setPresetNames (names);
+    refreshSetlistPositions();
     listContent.setActiveIndex (presetManager.getCurrentPresetIndex());
     listContent.setSize (viewport.getWidth(), names.size() * PresetListContent::rowHeight);
 }
 
+void PresetListComponent::refreshSetlistPositions()
+{
+    std::vector<int> positions;
+    for (int i = 0; i < presetManager.getNumPresets(); ++i)
+        positions.push_back (presetManager.getSetlistPosition (i));
+
+    listContent.setSetlistPositions (std::move (positions));
+}
+
 void PresetListComponent::setActivePreset (int index)
 {
     listContent.setActiveIndex (index);
@@ -12,6 +12,7 @@ public:
     void mouseDown (const juce::MouseEvent& e) override;
 
     void setPresetNames (const juce::StringArray& names);
+    void setSetlistPositions (std::vector<int> positions);   // per row, -1 if not in the setlist
     void setActiveIndex (int index);
     int getActiveIndex() const { return activeIndex; }
 
@@ -21,10 +22,14 @@ public:
     std::function<void(int)> onDeleteRequested;
     std::function<void(int, const juce::String&)> onRenameRequested;
 
+    enum class SetlistEdit { add, remove, moveEarlier, moveLater };
+    std::function<void(int, SetlistEdit)> onSetlistEditRequested;
+
     static constexpr int rowHeight = 40;
 
 private:
     juce::StringArray presetNames;
+    std::vector<int> setlistPositions;
     int activeIndex = -1;
 
     void showContextMenu (int rowIndex);
@@ -55,6 +60,7 @@ public:
     void paint (juce::Graphics& g) override;
 
     void refreshPresetList();
+    void refreshSetlistPositions();
     void setActivePreset (int index);
 
     std::function<void(int)> onPresetSelected;
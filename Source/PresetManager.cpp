@@ -1,4 +1,5 @@
 #include "PresetManager.h"
+#include <algorithm>
 
 PresetManager::PresetManager()
 {
@@ -20,100 +21,377 @@ juce::File PresetManager::getDefaultPresetsDir()
 
 void PresetManager::setSamplesDir (const juce::File& dir)
 {
+    std::lock_guard<std::mutex> lock (mutex);
     samplesDir = dir;
 }
 
 void PresetManager::setPresetsDir (const juce::File& dir)
 {
+    std::lock_guard<std::mutex> lock (mutex);
     presetsDir = dir;
 }
 
-void PresetManager::scanForPresets()
+juce::File PresetManager::getSamplesDir() const
 {
-    presets.clear();
+    std::lock_guard<std::mutex> lock (mutex);
+    return samplesDir;
+}
 
-    if (! presetsDir.isDirectory())
-        return;
+juce::File PresetManager::getPresetsDir() const
+{
+    std::lock_guard<std::mutex> lock (mutex);
+    return presetsDir;
+}
 
-    auto dkitFiles = presetsDir.findChildFiles (juce::File::findFiles, true, "*.dkit");
-    dkitFiles.sort();
+void PresetManager::scanForPresets()
+{
+    std::vector<PresetEntry> found;
 
-    for (auto& f : dkitFiles)
+    for (auto& f : presetIndex.refresh (getPresetsDir()))
     {
         PresetEntry entry;
         entry.name = f.getFileNameWithoutExtension();
         entry.file = f;
-        presets.push_back (entry);
+        found.push_back (entry);
+    }
+
+    sortPresets (found);
+
+    std::lock_guard<std::mutex> lock (mutex);
+    presets = std::move (found);
+}
+
+bool PresetManager::applyFileChanges (const DirectoryWatcher::ChangeSet& changeSet)
+{
+    if (changeSet.overflowed)
+    {
+        scanForPresets();
+        return true;
+    }
+
+    std::vector<juce::File> changed, removed;
+
+    for (auto& change : changeSet.changes)
+    {
+        if (change.isDirectory)
+        {
+            // A directory's presets are dropped and, unless it is gone,
+            // listed again from just that directory
+            removed.push_back (change.file);
+
+            if (change.type != DirectoryWatcher::Change::Type::deleted && change.file.isDirectory())
+                for (const auto& entry : juce::RangedDirectoryIterator (change.file, true, "*.dkit", juce::File::findFiles))
+                    changed.push_back (entry.getFile());
+        }
+        else if (change.file.hasFileExtension ("dkit"))
+        {
+            if (change.type == DirectoryWatcher::Change::Type::deleted)
+                removed.push_back (change.file);
+            else
+                changed.push_back (change.file);
+        }
+    }
+
+    if (changed.empty() && removed.empty())
+        return false;
+
+    presetIndex.update (changed, removed);
+
+    std::lock_guard<std::mutex> lock (mutex);
+
+    auto isRemoved = [&removed] (const juce::File& file)
+    {
+        for (auto& r : removed)
+            if (file == r || file.isAChildOf (r))
+                return true;
+
+        return false;
+    };
+
+    auto patched = presets;
+    patched.erase (std::remove_if (patched.begin(), patched.end(),
+                                   [&] (const PresetEntry& entry) { return isRemoved (entry.file); }),
+                   patched.end());
+
+    for (auto& file : changed)
+    {
+        bool listed = std::any_of (patched.begin(), patched.end(),
+                                   [&file] (const PresetEntry& entry) { return entry.file == file; });
+
+        if (! listed && file.existsAsFile())
+            patched.push_back ({ file.getFileNameWithoutExtension(), file });
     }
 
-    std::sort (presets.begin(), presets.end(), [] (const PresetEntry& a, const PresetEntry& b)
+    sortPresets (patched);
+
+    bool listChanged = patched.size() != presets.size()
+                        || ! std::equal (patched.begin(), patched.end(), presets.begin(),
+                                         [] (const PresetEntry& a, const PresetEntry& b) { return a.file == b.file; });
+
+    if (! listChanged)
+        return false;
+
+    // The current preset keeps its place by file; if it went away, nothing is current
+    auto currentFile = currentIndex >= 0 && currentIndex < (int) presets.size() ? presets[(size_t) currentIndex].file
+                                                                                : juce::File();
+    presets = std::move (patched);
+    currentIndex = currentFile != juce::File() ? findPreset (currentFile) : -1;
+
+    return true;
+}
+
+void PresetManager::sortPresets (std::vector<PresetEntry>& entries)
+{
+    std::sort (entries.begin(), entries.end(), [] (const PresetEntry& a, const PresetEntry& b)
     {
-        return a.name.compareIgnoreCase (b.name) < 0;
+        if (auto byName = a.name.compareIgnoreCase (b.name); byName != 0)
+            return byName < 0;
+
+        return a.file.getFullPathName() < b.file.getFullPathName();
     });
 }
 
 int PresetManager::getNumPresets() const
 {
+    std::lock_guard<std::mutex> lock (mutex);
     return (int) presets.size();
 }
 
 juce::String PresetManager::getPresetName (int index) const
 {
+    std::lock_guard<std::mutex> lock (mutex);
     if (index >= 0 && index < (int) presets.size())
         return presets[(size_t) index].name;
     return {};
 }
 
+int PresetManager::getCurrentPresetIndex() const
+{
+    std::lock_guard<std::mutex> lock (mutex);
+    return currentIndex;
+}
+
+DkitPreset PresetManager::getCurrentKit() const
+{
+    std::lock_guard<std::mutex> lock (mutex);
+    return currentKit;
+}
+
 bool PresetManager::loadPreset (int index)
 {
-    if (index < 0 || index >= (int) presets.size())
+    auto file = getPresetFile (index);
+    if (file == juce::File())
         return false;
 
-    auto& entry = presets[(size_t) index];
+    return setCurrentPreset (index, readPreset (file));
+}
+
+DkitPreset PresetManager::readPreset (const juce::File& file)
+{
+    return presetIndex.read (file);
+}
 
-    if (! loadDkitFile (entry.file))
+bool PresetManager::setCurrentPreset (int index, DkitPreset kit)
+{
+    if (kit.name.isEmpty())
         return false;
 
-    currentIndex = index;
+    {
+        std::lock_guard<std::mutex> lock (mutex);
+        if (index < 0 || index >= (int) presets.size())
+            return false;
+
+        currentIndex = index;
+        currentKit = kit;
+    }
 
     if (onPresetLoaded)
-        onPresetLoaded (currentKit);
+        onPresetLoaded (kit);
 
     return true;
 }
 
 bool PresetManager::loadNextPreset()
 {
+    int next = getNeighbourIndex (getCurrentPresetIndex(), 1);
+    return next >= 0 && loadPreset (next);
+}
+
+bool PresetManager::loadPreviousPreset()
+{
+    int prev = getNeighbourIndex (getCurrentPresetIndex(), -1);
+    return prev >= 0 && loadPreset (prev);
+}
+
+int PresetManager::getNeighbourIndex (int index, int steps) const
+{
+    std::lock_guard<std::mutex> lock (mutex);
     if (presets.empty())
-        return false;
+        return -1;
 
-    int next = currentIndex + 1;
-    if (next >= (int) presets.size())
-        next = 0;
+    auto order = getNavigationOrder();
+    const int count = (int) order.size();
+    auto current = std::find (order.begin(), order.end(), index);
 
-    return loadPreset (next);
+    // From outside the order, the first step lands on its first or last entry
+    int position = current != order.end() ? (int) (current - order.begin())
+                                           : (steps > 0 ? -1 : 0);
+
+    return order[(size_t) ((((position + steps) % count) + count) % count)];
 }
 
-bool PresetManager::loadPreviousPreset()
+int PresetManager::getNumPrograms() const
 {
-    if (presets.empty())
-        return false;
+    std::lock_guard<std::mutex> lock (mutex);
+    return (int) getNavigationOrder().size();
+}
 
-    int prev = currentIndex - 1;
-    if (prev < 0)
-        prev = (int) presets.size() - 1;
+int PresetManager::getPresetIndexForProgram (int program) const
+{
+    std::lock_guard<std::mutex> lock (mutex);
+    auto order = getNavigationOrder();
+    return program >= 0 && program < (int) order.size() ? order[(size_t) program] : -1;
+}
 
-    return loadPreset (prev);
+int PresetManager::getProgramForPresetIndex (int index) const
+{
+    std::lock_guard<std::mutex> lock (mutex);
+    auto order = getNavigationOrder();
+    auto found = std::find (order.begin(), order.end(), index);
+    return found != order.end() ? (int) (found - order.begin()) : -1;
 }
 
-bool PresetManager::loadDkitFile (const juce::File& file)
+std::vector<int> PresetManager::getNavigationOrder() const
 {
-    auto preset = parseDkitJson (file);
-    if (preset.name.isEmpty())
-        return false;
+    std::vector<int> order;
 
-    currentKit = preset;
-    return true;
+    if (setlistActive)
+        for (auto& file : setlist)
+            if (auto found = findPreset (file); found >= 0)
+                order.push_back (found);
+
+    // An active but empty setlist doesn't restrict anything
+    if (order.empty())
+        for (int i = 0; i < (int) presets.size(); ++i)
+            order.push_back (i);
+
+    return order;
+}
+
+//==============================================================================
+void PresetManager::setSetlist (std::vector<juce::File> presetFiles)
+{
+    {
+        std::lock_guard<std::mutex> lock (mutex);
+        setlist = std::move (presetFiles);
+    }
+
+    notifySetlistChanged();
+}
+
+std::vector<juce::File> PresetManager::getSetlist() const
+{
+    std::lock_guard<std::mutex> lock (mutex);
+    return setlist;
+}
+
+void PresetManager::addToSetlist (int index)
+{
+    {
+        std::lock_guard<std::mutex> lock (mutex);
+        if (index < 0 || index >= (int) presets.size())
+            return;
+
+        auto& file = presets[(size_t) index].file;
+        if (std::find (setlist.begin(), setlist.end(), file) != setlist.end())
+            return;
+
+        setlist.push_back (file);
+    }
+
+    notifySetlistChanged();
+}
+
+void PresetManager::removeFromSetlist (int index)
+{
+    {
+        std::lock_guard<std::mutex> lock (mutex);
+        if (index < 0 || index >= (int) presets.size())
+            return;
+
+        auto& file = presets[(size_t) index].file;
+        setlist.erase (std::remove (setlist.begin(), setlist.end(), file), setlist.end());
+    }
+
+    notifySetlistChanged();
+}
+
+void PresetManager::moveInSetlist (int index, int delta)
+{
+    {
+        std::lock_guard<std::mutex> lock (mutex);
+        if (index < 0 || index >= (int) presets.size())
+            return;
+
+        auto entry = std::find (setlist.begin(), setlist.end(), presets[(size_t) index].file);
+        if (entry == setlist.end())
+            return;
+
+        auto from = (int) (entry - setlist.begin());
+        auto to = juce::jlimit (0, (int) setlist.size() - 1, from + delta);
+        if (to == from)
+            return;
+
+        auto file = *entry;
+        setlist.erase (entry);
+        setlist.insert (setlist.begin() + to, file);
+    }
+
+    notifySetlistChanged();
+}
+
+int PresetManager::getSetlistPosition (int index) const
+{
+    std::lock_guard<std::mutex> lock (mutex);
+    if (index < 0 || index >= (int) presets.size())
+        return -1;
+
+    auto entry = std::find (setlist.begin(), setlist.end(), presets[(size_t) index].file);
+    return entry != setlist.end() ? (int) (entry - setlist.begin()) : -1;
+}
+
+void PresetManager::setSetlistActive (bool shouldBeActive)
+{
+    {
+        std::lock_guard<std::mutex> lock (mutex);
+        if (setlistActive == shouldBeActive)
+            return;
+
+        setlistActive = shouldBeActive;
+    }
+
+    notifySetlistChanged();
+}
+
+bool PresetManager::isSetlistActive() const
+{
+    std::lock_guard<std::mutex> lock (mutex);
+    return setlistActive;
+}
+
+int PresetManager::findPreset (const juce::File& file) const
+{
+    for (int i = 0; i < (int) presets.size(); ++i)
+        if (presets[(size_t) i].file == file)
+            return i;
+
+    return -1;
+}
+
+void PresetManager::notifySetlistChanged()
+{
+    if (onSetlistChanged)
+        onSetlistChanged();
 }
 
 DkitPreset PresetManager::parseDkitJson (const juce::File& file)
@@ -180,7 +458,8 @@ bool PresetManager::writeDkitJson (const juce::File& file, const DkitPreset& pre
 bool PresetManager::savePreset (const juce::String& name,
                                  const std::map<int, juce::File>& padMappings)
 {
-    presetsDir.createDirectory();
+    auto dir = getPresetsDir();
+    dir.createDirectory();
 
     DkitPreset preset;
     preset.name = name;
@@ -196,12 +475,13 @@ bool PresetManager::savePreset (const juce::String& name,
         preset.pads.push_back (pad);
     }
 
-    auto file = presetsDir.getChildFile (name + ".dkit");
+    auto file = dir.getChildFile (name + ".dkit");
     return writeDkitJson (file, preset);
 }
 
 juce::File PresetManager::getPresetFile (int index) const
 {
+    std::lock_guard<std::mutex> lock (mutex);
     if (index >= 0 && index < (int) presets.size())
         return presets[(size_t) index].file;
     return {};
@@ -209,36 +489,51 @@ juce::File PresetManager::getPresetFile (int index) const
 
 bool PresetManager::deletePreset (int index)
 {
-    if (index < 0 || index >= (int) presets.size())
-        return false;
+    int presetToLoad = -1;
+    bool wasInSetlist = false;
 
-    auto& entry = presets[(size_t) index];
+    {
+        std::lock_guard<std::mutex> lock (mutex);
+        if (index < 0 || index >= (int) presets.size())
+            return false;
 
-    if (! entry.file.deleteFile())
-        return false;
+        auto& entry = presets[(size_t) index];
 
-    presets.erase (presets.begin() + index);
+        if (! entry.file.deleteFile())
+            return false;
 
-    if (presets.empty())
-    {
-        currentIndex = -1;
-        currentKit = {};
-    }
-    else if (index == currentIndex)
-    {
-        int newIdx = juce::jmin (index, (int) presets.size() - 1);
-        loadPreset (newIdx);
-    }
-    else if (index < currentIndex)
-    {
-        --currentIndex;
+        auto removed = std::remove (setlist.begin(), setlist.end(), entry.file);
+        wasInSetlist = removed != setlist.end();
+        setlist.erase (removed, setlist.end());
+        presets.erase (presets.begin() + index);
+
+        if (presets.empty())
+        {
+            currentIndex = -1;
+            currentKit = {};
+        }
+        else if (index == currentIndex)
+        {
+            presetToLoad = juce::jmin (index, (int) presets.size() - 1);
+        }
+        else if (index < currentIndex)
+        {
+            --currentIndex;
+        }
     }
 
+    if (wasInSetlist)
+        notifySetlistChanged();
+
+    if (presetToLoad >= 0)
+        loadPreset (presetToLoad);
+
     return true;
 }
 
 bool PresetManager::renamePreset (int index, const juce::String& newName)
 {
+    std::unique_lock<std::mutex> lock (mutex);
     if (index < 0 || index >= (int) presets.size())
         return false;
 
@@ -251,7 +546,7 @@ bool PresetManager::renamePreset (int index, const juce::String& newName)
     if (newFile.existsAsFile() && newFile != entry.file)
         return false;
 
-    auto preset = parseDkitJson (entry.file);
+    auto preset = presetIndex.read (entry.file);
     if (preset.name.isEmpty())
         return false;
 
@@ -265,6 +560,9 @@ bool PresetManager::renamePreset (int index, const juce::String& newName)
             return false;
     }
 
+    bool inSetlist = std::find (setlist.begin(), setlist.end(), entry.file) != setlist.end();
+    std::replace (setlist.begin(), setlist.end(), entry.file, newFile);
+
     entry.name = newName;
     entry.file = newFile;
 
@@ -274,6 +572,11 @@ bool PresetManager::renamePreset (int index, const juce::String& newName)
         currentKit.sourceFile = newFile;
     }
 
+    lock.unlock();
+
+    if (inSetlist)
+        notifySetlistChanged();
+
     return true;
 }
 
@@ -282,7 +585,7 @@ juce::File PresetManager::resolveSamplePath (const juce::String& relativePath) c
     if (relativePath.isEmpty())
         return {};
 
-    return samplesDir.getChildFile (relativePath);
+    return getSamplesDir().getChildFile (relativePath);
 }
 
 juce::String PresetManager::makeRelativeSamplePath (const juce::File& sampleFile)
@@ -291,6 +594,7 @@ juce::String PresetManager::makeRelativeSamplePath (const juce::File& sampleFile
         return {};
 
     // If the file is already inside samplesDir, compute relative path
+    auto samplesDir = getSamplesDir();
     auto sampleFullPath = sampleFile.getFullPathName();
     auto samplesFullPath = samplesDir.getFullPathName();
 
@@ -1,7 +1,10 @@
 #pragma once
 #include <juce_core/juce_core.h>
+#include "DirectoryWatcher.h"
+#include "PresetIndex.h"
 #include <vector>
 #include <functional>
+#include <mutex>
 
 struct DkitPadMapping
 {
@@ -21,6 +24,9 @@ struct DkitPreset
     std::vector<DkitPadMapping> pads;
 };
 
+// Thread-safe: presets are loaded from PresetNavigator's thread as well as
+// the message thread, and scanned in the background. Scans and loads go
+// through a PresetIndex, so they only touch files that changed.
 class PresetManager
 {
 public:
@@ -28,20 +34,52 @@ public:
 
     void setSamplesDir (const juce::File& dir);
     void setPresetsDir (const juce::File& dir);
-    juce::File getSamplesDir() const { return samplesDir; }
-    juce::File getPresetsDir() const { return presetsDir; }
+    juce::File getSamplesDir() const;
+    juce::File getPresetsDir() const;
 
     void scanForPresets();
 
+    // Patches the preset list and index with changes reported under the
+    // presets directory, re-reading only what changed. Returns true if the
+    // list itself changed.
+    bool applyFileChanges (const DirectoryWatcher::ChangeSet& changeSet);
+
     int getNumPresets() const;
     juce::String getPresetName (int index) const;
-    int getCurrentPresetIndex() const { return currentIndex; }
+    int getCurrentPresetIndex() const;
 
     bool loadPreset (int index);
     bool loadNextPreset();
     bool loadPreviousPreset();
 
-    const DkitPreset& getCurrentKit() const { return currentKit; }
+    // Makes an already parsed preset current, as loadPreset does after
+    // reading it.
+    bool setCurrentPreset (int index, DkitPreset kit);
+
+    DkitPreset getCurrentKit() const;
+
+    // The preset steps away from index, wrapping at the ends, and staying
+    // within the setlist while it is active. -1 if there are no presets.
+    int getNeighbourIndex (int index, int steps) const;
+
+    // Host programs: the setlist while it is active, else every preset.
+    int getNumPrograms() const;
+    int getPresetIndexForProgram (int program) const;   // -1 if out of range
+    int getProgramForPresetIndex (int index) const;     // -1 if not a program
+
+    // An ordered subset of the presets for a gig, kept by file so it
+    // survives rescans. While active, next/previous only move within it.
+    void setSetlist (std::vector<juce::File> presetFiles);
+    std::vector<juce::File> getSetlist() const;
+    void addToSetlist (int index);
+    void removeFromSetlist (int index);
+    void moveInSetlist (int index, int delta);
+    int getSetlistPosition (int index) const;   // -1 if not in the setlist
+
+    void setSetlistActive (bool shouldBeActive);
+    bool isSetlistActive() const;
+
+    std::function<void()> onSetlistChanged;
 
     bool savePreset (const juce::String& name,
                      const std::map<int, juce::File>& padMappings);
@@ -50,6 +88,8 @@ public:
     bool renamePreset (int index, const juce::String& newName);
     juce::File getPresetFile (int index) const;
 
+    // Called on whichever thread set the preset. Owned by the processor; set
+    // it once, before anything can load a preset.
     std::function<void (const DkitPreset&)> onPresetLoaded;
 
     static juce::File getDefaultSamplesDir();
@@ -58,6 +98,10 @@ public:
     juce::File resolveSamplePath (const juce::String& relativePath) const;
     juce::String makeRelativeSamplePath (const juce::File& sampleFile);
 
+    // Reads a preset through the PresetIndex, so only new or changed files
+    // are parsed.
+    DkitPreset readPreset (const juce::File& file);
+
     static DkitPreset parseDkitJson (const juce::File& file);
     static bool writeDkitJson (const juce::File& file, const DkitPreset& preset);
 
@@ -68,11 +112,22 @@ private:
         juce::File file;
     };
 
+    PresetIndex presetIndex;
+
+    mutable std::mutex mutex;
     juce::File samplesDir;
     juce::File presetsDir;
     std::vector<PresetEntry> presets;
     int currentIndex = -1;
     DkitPreset currentKit;
+    std::vector<juce::File> setlist;
+    bool setlistActive = false;
+
+    static void sortPresets (std::vector<PresetEntry>& entries);
+
+    // Caller holds mutex
+    int findPreset (const juce::File& file) const;
+    std::vector<int> getNavigationOrder() const;
 
-    bool loadDkitFile (const juce::File& file);
+    void notifySetlistChanged();
 };
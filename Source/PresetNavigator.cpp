@@ -0,0 +1,92 @@
+#include "PresetNavigator.h"
+
+PresetNavigator::PresetNavigator (PresetManager& presets)
+    : juce::Thread ("Beatwerk preset navigator"),
+      presetManager (presets)
+{
+    startThread();
+}
+
+PresetNavigator::~PresetNavigator()
+{
+    stopThread (5000);
+}
+
+void PresetNavigator::step (int delta) noexcept
+{
+    pendingSteps.fetch_add (delta);
+    ++generation;
+}
+
+void PresetNavigator::jumpTo (int index) noexcept
+{
+    pendingIndex.store (index);
+    pendingProgram.store (-1);
+    pendingSteps.store (0);
+    ++generation;
+    notify();
+}
+
+void PresetNavigator::selectProgram (int program) noexcept
+{
+    pendingProgram.store (program);
+    pendingIndex.store (-1);
+    pendingSteps.store (0);
+    ++generation;
+}
+
+void PresetNavigator::run()
+{
+    juce::uint32 handled = generation.load();
+
+    while (! threadShouldExit())
+    {
+        // Waking the thread takes a lock, so requests from the audio thread
+        // only bump the generation and are found here
+        if (generation.load() == handled)
+        {
+            wait (kPollIntervalMs);
+            continue;
+        }
+
+        int target = presetManager.getCurrentPresetIndex();
+        bool superseded = false;
+
+        while (! threadShouldExit())
+        {
+            auto requestGeneration = generation.load();
+            handled = requestGeneration;
+            auto jump = pendingIndex.exchange (-1);
+            auto steps = pendingSteps.exchange (0);
+
+            // Resolved here rather than on the caller's thread, which may be
+            // the audio thread
+            if (auto program = pendingProgram.exchange (-1); program >= 0)
+                jump = presetManager.getPresetIndexForProgram (program);
+
+            if (jump < 0 && steps == 0 && ! superseded)
+                break;
+
+            if (jump >= 0)
+                target = jump;
+
+            // Within the setlist while one is active
+            if (steps != 0)
+                target = presetManager.getNeighbourIndex (target, steps);
+
+            if (target < 0)
+                break;
+
+            auto kit = presetManager.readPreset (presetManager.getPresetFile (target));
+
+            // More presses arrived while reading; carry on from this target
+            // without handing it to the engine
+            superseded = generation.load() != requestGeneration;
+            if (superseded)
+                continue;
+
+            presetManager.setCurrentPreset (target, std::move (kit));
+            break;
+        }
+    }
+}
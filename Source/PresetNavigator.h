@@ -0,0 +1,44 @@
+#pragma once
+#include <juce_core/juce_core.h>
+#include "PresetManager.h"
+#include <atomic>
+
+// Loads presets requested by MIDI navigation on its own thread, independent
+// of the message thread. Requests only accumulate into one pending target,
+// so a burst of next/prev presses loads the final destination once; a load
+// that is overtaken while its preset is being read is dropped before it
+// reaches the engine.
+class PresetNavigator : private juce::Thread
+{
+public:
+    explicit PresetNavigator (PresetManager& presets);
+    ~PresetNavigator() override;
+
+    // Moves the pending target by delta presets, wrapping at the ends.
+    // Only touches atomics, so callable from processBlock; the loader picks
+    // the request up on its next poll.
+    void step (int delta) noexcept;
+
+    // Replaces the pending target, discarding any steps not yet taken.
+    // Wakes the loader straight away, so not for the audio thread.
+    void jumpTo (int index) noexcept;
+
+    // As jumpTo, by host program number; see PresetManager::getNumPrograms.
+    // Lock-free like step(), since hosts may call it from processBlock.
+    void selectProgram (int program) noexcept;
+
+private:
+    // How often the loader checks for requests that didn't wake it
+    static constexpr int kPollIntervalMs = 10;
+
+    PresetManager& presetManager;
+
+    std::atomic<int> pendingSteps { 0 };
+    std::atomic<int> pendingIndex { -1 };
+    std::atomic<int> pendingProgram { -1 };
+    std::atomic<juce::uint32> generation { 0 };
+
+    void run() override;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (PresetNavigator)
+};
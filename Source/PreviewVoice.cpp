@@ -0,0 +1,217 @@
+#include "PreviewVoice.h"
+
+PreviewVoice::Stream::Stream (juce::AudioFormatReader* reader, std::shared_ptr<juce::TimeSliceThread> thread,
+                              double playbackRate, float g)
+    : numChannels (juce::jlimit (1, 2, (int) reader->numChannels)),
+      gain (g),
+      readAheadThread (std::move (thread)),
+      readerSource (reader, true),
+      buffered (&readerSource, *readAheadThread, false, kReadAheadSamples, numChannels),
+      resampled (&buffered, false, numChannels)
+{
+    resampled.setResamplingRatio (reader->sampleRate / playbackRate);
+}
+
+//==============================================================================
+PreviewVoice::PreviewVoice (juce::AudioFormatManager& formats)
+    : juce::Thread ("Beatwerk preview loader"),
+      formatManager (formats),
+      readAheadThread (std::make_shared<juce::TimeSliceThread> ("Beatwerk preview read-ahead"))
+{
+    readAheadThread->startThread (juce::Thread::Priority::high);
+    startThread();
+}
+
+PreviewVoice::~PreviewVoice()
+{
+    stopThread (5000);
+    stop();
+
+    playing = nullptr;
+    fading = nullptr;
+}
+
+void PreviewVoice::prepareToPlay (double sampleRate, int samplesPerBlock)
+{
+    std::lock_guard<std::mutex> lock (mutex);
+
+    pendingRequest.reset();
+    ++requestId;
+    publish (nullptr);
+
+    playbackRate = sampleRate;
+    blockSize = juce::jmax (1, samplesPerBlock);
+
+    // Nothing renders while the host prepares, so the audio thread's state
+    // can be reset here
+    playing = nullptr;
+    fading = nullptr;
+    renderedSerial.store (streamSerial.load());
+    sounding.store (false);
+    scratch.setSize (2, blockSize);
+}
+
+void PreviewVoice::releaseResources()
+{
+    stop();
+}
+
+void PreviewVoice::play (const juce::File& file, float gain)
+{
+    {
+        std::lock_guard<std::mutex> lock (mutex);
+        pendingRequest = Request { file, gain, ++requestId };
+    }
+
+    notify();
+}
+
+void PreviewVoice::stop()
+{
+    std::lock_guard<std::mutex> lock (mutex);
+
+    pendingRequest.reset();
+    ++requestId;
+    publish (nullptr);
+}
+
+//==============================================================================
+void PreviewVoice::run()
+{
+    while (! threadShouldExit())
+    {
+        wait (-1);
+
+        while (! threadShouldExit())
+        {
+            std::optional<Request> request;
+
+            {
+                std::lock_guard<std::mutex> lock (mutex);
+                request.swap (pendingRequest);
+            }
+
+            if (! request.has_value())
+                break;
+
+            auto stream = open (*request);
+
+            std::lock_guard<std::mutex> lock (mutex);
+            if (request->id == requestId)
+                publish (std::move (stream));
+        }
+    }
+}
+
+PreviewVoice::Stream::Ptr PreviewVoice::open (const Request& request)
+{
+    std::unique_ptr<juce::AudioFormatReader> reader (formatManager.createReaderFor (request.file));
+    if (reader == nullptr || reader->lengthInSamples <= 0 || reader->sampleRate <= 0)
+        return nullptr;
+
+    double rate;
+    int samplesPerBlock;
+
+    {
+        std::lock_guard<std::mutex> lock (mutex);
+        rate = playbackRate;
+        samplesPerBlock = blockSize;
+    }
+
+    const auto ratio = reader->sampleRate / rate;
+    const auto length = reader->lengthInSamples;
+    Stream::Ptr stream = new Stream (reader.release(), readAheadThread, rate, request.gain);
+    stream->resampled.prepareToPlay (samplesPerBlock, rate);
+
+    // Publishing before the first blocks are buffered would play silence
+    // in place of the attack
+    auto firstSamples = juce::jmin ((juce::int64) std::ceil (samplesPerBlock * ratio) * 4, length - 1);
+    juce::AudioSourceChannelInfo firstBlocks (nullptr, 0, (int) firstSamples);
+    stream->buffered.waitForNextAudioBlockReady (firstBlocks, (juce::uint32) kStartTimeoutMs);
+
+    return stream;
+}
+
+void PreviewVoice::publish (Stream::Ptr stream)
+{
+    if (stream == nullptr && currentOwner == nullptr)
+        return;
+
+    auto previous = std::move (currentOwner);
+    currentOwner = std::move (stream);
+    current.store (currentOwner.get());
+    streamSerial.fetch_add (1);
+
+    releasePool->retire (std::move (previous));
+}
+
+//==============================================================================
+bool PreviewVoice::isActive() const noexcept
+{
+    return streamSerial.load() != renderedSerial.load() || sounding.load();
+}
+
+void PreviewVoice::renderNextBlock (juce::AudioBuffer<float>& outputBuffer, int startSample, int numSamples) noexcept
+{
+    auto serial = streamSerial.load();
+    if (serial != renderedSerial.load (std::memory_order_relaxed))
+    {
+        ReleasePool::ScopedAcquire acquire (*releasePool);
+
+        if (auto* next = current.load(); next != playing.get())
+        {
+            fading = std::move (playing);
+            playing = next;
+        }
+
+        renderedSerial.store (serial);
+    }
+
+    // The pool holds the last reference to a replaced stream, so dropping
+    // ours here never frees
+    if (fading != nullptr)
+    {
+        render (*fading, outputBuffer, startSample, numSamples, 1.0f, 0.0f);
+        fading = nullptr;
+    }
+
+    if (playing != nullptr)
+    {
+        render (*playing, outputBuffer, startSample, numSamples, 1.0f, 1.0f);
+
+        if (playing->isFinished())
+            playing = nullptr;
+    }
+
+    sounding.store (playing != nullptr);
+}
+
+void PreviewVoice::render (Stream& stream, juce::AudioBuffer<float>& outputBuffer, int startSample, int numSamples,
+                           float startGain, float endGain) noexcept
+{
+    const int outChannels = juce::jmin (outputBuffer.getNumChannels(), 2);
+    const int chunkSize = scratch.getNumSamples();
+
+    if (outChannels == 0 || chunkSize == 0)
+        return;
+
+    // In chunks of at most the prepared block size, so the resampler
+    // never has to grow its buffers here
+    for (int done = 0; done < numSamples;)
+    {
+        const int n = juce::jmin (numSamples - done, chunkSize);
+        const float gain0 = stream.gain * (startGain + (endGain - startGain) * (float) done / (float) numSamples);
+        const float gain1 = stream.gain * (startGain + (endGain - startGain) * (float) (done + n) / (float) numSamples);
+
+        juce::AudioBuffer<float> block (scratch.getArrayOfWritePointers(), stream.numChannels, n);
+        juce::AudioSourceChannelInfo info (&block, 0, n);
+        stream.resampled.getNextAudioBlock (info);
+
+        for (int ch = 0; ch < outChannels; ++ch)
+            outputBuffer.addFromWithRamp (ch, startSample + done,
+                                          block.getReadPointer (juce::jmin (ch, stream.numChannels - 1)),
+                                          n, gain0, gain1);
+
+        done += n;
+    }
+}
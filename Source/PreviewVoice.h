@@ -0,0 +1,95 @@
+#pragma once
+#include <juce_audio_formats/juce_audio_formats.h>
+#include "ReleasePool.h"
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <optional>
+
+// Plays the sample browser's previews, apart from the pads. The file is
+// streamed rather than decoded up front: a read-ahead buffer filled on a
+// background thread feeds a resampler to the playback rate, so a preview
+// starts once its first blocks are read, however long the file is.
+//
+// Streams are opened on the voice's own thread and published to the audio
+// thread the same way as the engine's kit banks.
+class PreviewVoice : private juce::Thread
+{
+public:
+    explicit PreviewVoice (juce::AudioFormatManager& formats);
+    ~PreviewVoice() override;
+
+    // Stops the preview; it plays at the new rate from the next one.
+    void prepareToPlay (double sampleRate, int samplesPerBlock);
+    void releaseResources();
+
+    // Replaces whatever is previewing, which fades out over a block.
+    void play (const juce::File& file, float gain);
+    void stop();
+
+    // Audio thread. Adds the preview to the output.
+    void renderNextBlock (juce::AudioBuffer<float>& outputBuffer, int startSample, int numSamples) noexcept;
+    bool isActive() const noexcept;
+
+    static constexpr int kReadAheadSamples = 65536;
+    static constexpr int kStartTimeoutMs = 200;
+
+private:
+    struct Stream : public juce::ReferenceCountedObject
+    {
+        using Ptr = juce::ReferenceCountedObjectPtr<Stream>;
+
+        Stream (juce::AudioFormatReader* reader, std::shared_ptr<juce::TimeSliceThread> thread,
+                double playbackRate, float gain);
+
+        bool isFinished() const { return buffered.getNextReadPosition() >= buffered.getTotalLength(); }
+
+        const int numChannels;
+        const float gain;
+
+        // The read-ahead thread must outlive the buffer using it, wherever
+        // the ReleasePool frees the stream
+        std::shared_ptr<juce::TimeSliceThread> readAheadThread;
+        juce::AudioFormatReaderSource readerSource;
+        juce::BufferingAudioSource buffered;
+        juce::ResamplingAudioSource resampled;
+    };
+
+    struct Request
+    {
+        juce::File file;
+        float gain = 1.0f;
+        int id = 0;
+    };
+
+    juce::AudioFormatManager& formatManager;
+    std::shared_ptr<juce::TimeSliceThread> readAheadThread;
+    juce::SharedResourcePointer<ReleasePool> releasePool;
+
+    // Guarded by mutex. requestId changes with every play and stop, so a
+    // stream opened for an older request is dropped.
+    std::mutex mutex;
+    std::optional<Request> pendingRequest;
+    int requestId = 0;
+    double playbackRate = 44100.0;
+    int blockSize = 512;
+    Stream::Ptr currentOwner;
+
+    // What the audio thread plays, as with SampleEngine::activeBank
+    std::atomic<Stream*> current { nullptr };
+    std::atomic<juce::uint32> streamSerial { 0 };
+
+    // Audio thread only, but for the atomics read by isActive()
+    Stream::Ptr playing, fading;
+    juce::AudioBuffer<float> scratch;
+    std::atomic<juce::uint32> renderedSerial { 0 };
+    std::atomic<bool> sounding { false };
+
+    void run() override;
+    Stream::Ptr open (const Request& request);
+    void publish (Stream::Ptr stream);  // caller holds mutex
+    void render (Stream& stream, juce::AudioBuffer<float>& outputBuffer, int startSample, int numSamples,
+                 float startGain, float endGain) noexcept;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (PreviewVoice)
+};
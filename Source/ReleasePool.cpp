@@ -0,0 +1,63 @@
+#include "ReleasePool.h"
+#include <algorithm>
+#include <iterator>
+
+ReleasePool::ReleasePool() : juce::Thread ("Beatwerk release pool")
+{
+    startThread (juce::Thread::Priority::low);
+}
+
+ReleasePool::~ReleasePool()
+{
+    stopThread (2000);
+}
+
+void ReleasePool::run()
+{
+    while (! threadShouldExit())
+    {
+        collectGarbage();
+
+        {
+            std::lock_guard<std::mutex> lock (collectorsMutex);
+            for (auto* collector : collectors)
+                collector->collectGarbage();
+        }
+
+        wait (100);
+    }
+}
+
+void ReleasePool::addCollector (Collector* collector)
+{
+    std::lock_guard<std::mutex> lock (collectorsMutex);
+    collectors.push_back (collector);
+}
+
+void ReleasePool::removeCollector (Collector* collector)
+{
+    // Blocks until a collection pass using it has finished
+    std::lock_guard<std::mutex> lock (collectorsMutex);
+    collectors.erase (std::remove (collectors.begin(), collectors.end(), collector), collectors.end());
+}
+
+void ReleasePool::collectGarbage()
+{
+    std::vector<std::unique_ptr<RetiredObject>> toFree;
+
+    {
+        std::lock_guard<std::mutex> lock (retiredMutex);
+
+        if (activeAcquires.load() != 0)
+            return;
+
+        auto firstFree = std::partition (retired.begin(), retired.end(),
+                                         [] (const auto& r) { return ! r->isReleasable(); });
+
+        std::move (firstFree, retired.end(), std::back_inserter (toFree));
+        retired.erase (firstFree, retired.end());
+    }
+
+    // Released here, outside the lock, on the pool's own thread
+    toFree.clear();
+}
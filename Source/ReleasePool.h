@@ -0,0 +1,100 @@
+#pragma once
+#include <juce_core/juce_core.h>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+// Deferred deletion for reference-counted objects that the audio thread can
+// see. Publishers hand replaced objects to retire(); a background thread
+// frees each one once the pool holds its last reference, so the final
+// decrement never happens on the audio thread.
+//
+// Shared process-wide through juce::SharedResourcePointer.
+class ReleasePool : private juce::Thread
+{
+public:
+    ReleasePool();
+    ~ReleasePool() override;
+
+    // Call only after the object has been unpublished, i.e. no atomic that
+    // the audio thread reads points at it any more.
+    //
+    // sharedOwners counts references held by caches that only ever drop
+    // theirs once they hold the last one, such as SamplePool. The pool lets
+    // go of its own reference when those are all that remain.
+    //
+    // Retiring an object that is already pending is a no-op: a second entry
+    // would hold a reference the first one never counts, so neither would
+    // ever be released.
+    template <typename ObjectType>
+    void retire (juce::ReferenceCountedObjectPtr<ObjectType> object, int sharedOwners = 0)
+    {
+        if (object == nullptr)
+            return;
+
+        std::lock_guard<std::mutex> lock (retiredMutex);
+
+        for (auto& r : retired)
+            if (r->getObject() == object.get())
+                return; // the pending entry still holds a reference, so this isn't the last one
+
+        retired.push_back (std::make_unique<Entry<ObjectType>> (std::move (object), sharedOwners));
+    }
+
+    // Brackets a load of a published raw pointer that is then turned into a
+    // reference. Nothing is collected while any acquire is in flight.
+    class ScopedAcquire
+    {
+    public:
+        explicit ScopedAcquire (ReleasePool& p) noexcept : pool (p) { pool.activeAcquires.fetch_add (1); }
+        ~ScopedAcquire() noexcept                                   { pool.activeAcquires.fetch_sub (1); }
+
+    private:
+        ReleasePool& pool;
+        JUCE_DECLARE_NON_COPYABLE (ScopedAcquire)
+    };
+
+    // Extra clean-up run on the pool's thread after every collection pass.
+    struct Collector
+    {
+        virtual ~Collector() = default;
+        virtual void collectGarbage() = 0;
+    };
+
+    void addCollector (Collector* collector);
+    void removeCollector (Collector* collector);
+
+private:
+    struct RetiredObject
+    {
+        virtual ~RetiredObject() = default;
+        virtual bool isReleasable() const noexcept = 0;
+        virtual const void* getObject() const noexcept = 0;
+    };
+
+    template <typename ObjectType>
+    struct Entry : RetiredObject
+    {
+        Entry (juce::ReferenceCountedObjectPtr<ObjectType> o, int shared)
+            : object (std::move (o)), sharedOwners (shared) {}
+
+        bool isReleasable() const noexcept override { return object->getReferenceCount() <= 1 + sharedOwners; }
+        const void* getObject() const noexcept override { return object.get(); }
+
+        juce::ReferenceCountedObjectPtr<ObjectType> object;
+        int sharedOwners;
+    };
+
+    std::mutex retiredMutex;
+    std::vector<std::unique_ptr<RetiredObject>> retired;
+    std::atomic<int> activeAcquires { 0 };
+
+    std::mutex collectorsMutex;
+    std::vector<Collector*> collectors;
+
+    void run() override;
+    void collectGarbage();
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (ReleasePool)
+};
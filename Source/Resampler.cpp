@@ -0,0 +1,293 @@
+#include "Resampler.h"
+#include "SimdOps.h"
+#include <cmath>
+#include <map>
+#include <mutex>
+#include <numeric>
+#include <tuple>
+
+namespace
+{
+    struct QualitySettings
+    {
+        int baseTaps;
+        double kaiserBeta;
+        double passband;    // fraction of the output Nyquist kept flat
+    };
+
+    QualitySettings getSettings (Resampler::Quality quality)
+    {
+        switch (quality)
+        {
+            case Resampler::Quality::fast:      return { 16, 6.0, 0.85 };
+            case Resampler::Quality::high:      return { 64, 10.0, 0.95 };
+            case Resampler::Quality::standard:  break;
+        }
+
+        return { 32, 8.0, 0.91 };
+    }
+
+    double besselI0 (double x)
+    {
+        double sum = 1.0, term = 1.0;
+        for (int k = 1; k < 50; ++k)
+        {
+            term *= (x / (2.0 * k)) * (x / (2.0 * k));
+            sum += term;
+            if (term < sum * 1.0e-12)
+                break;
+        }
+        return sum;
+    }
+
+    // Dot product of one filter phase with two channels at once, so the
+    // coefficients are loaded once per tap group for a stereo sample.
+    template <int NumChannels>
+    inline void convolve (const float* coeffs, const float* const* input, int numTaps, float* result) noexcept
+    {
+        int k = 0;
+
+       #if BEATWERK_SIMD
+        using namespace SimdOps;
+        Vec acc[NumChannels];
+        for (auto& a : acc)
+            a = splat (0.0f);
+
+        for (; k + width <= numTaps; k += width)
+        {
+            auto c = load (coeffs + k);
+            for (int ch = 0; ch < NumChannels; ++ch)
+                acc[ch] = mulAdd (acc[ch], c, load (input[ch] + k));
+        }
+
+        for (int ch = 0; ch < NumChannels; ++ch)
+            result[ch] = sum (acc[ch]);
+       #else
+        for (int ch = 0; ch < NumChannels; ++ch)
+            result[ch] = 0.0f;
+       #endif
+
+        for (; k < numTaps; ++k)
+            for (int ch = 0; ch < NumChannels; ++ch)
+                result[ch] += coeffs[k] * input[ch][k];
+    }
+
+    template <int NumChannels>
+    void convertGroup (const float* const* padded, float* const* output, int outputLength,
+                       const float* coefficients, int numTaps,
+                       bool exact, int upFactor, int downFactor, double step)
+    {
+        juce::int64 index = 0;
+        int phase = 0;
+        const int wholeStep = exact ? downFactor / upFactor : 0;
+        const int fracStep = exact ? downFactor % upFactor : 0;
+        double position = 0.0;
+
+        for (int j = 0; j < outputLength; ++j)
+        {
+            if (! exact)
+            {
+                index = (juce::int64) position;
+                phase = (int) std::lround ((position - (double) index) * upFactor);
+                if (phase == upFactor)
+                {
+                    phase = 0;
+                    ++index;
+                }
+            }
+
+            // Window for output j starts numTaps / 2 - 1 samples before the
+            // input sample at or before it; padded is offset by numTaps / 2
+            const float* window[NumChannels];
+            for (int ch = 0; ch < NumChannels; ++ch)
+                window[ch] = padded[ch] + index + 1;
+
+            float result[NumChannels];
+            convolve<NumChannels> (coefficients + (size_t) phase * (size_t) numTaps, window, numTaps, result);
+
+            for (int ch = 0; ch < NumChannels; ++ch)
+                output[ch][j] = result[ch];
+
+            if (exact)
+            {
+                index += wholeStep;
+                phase += fracStep;
+                if (phase >= upFactor)
+                {
+                    phase -= upFactor;
+                    ++index;
+                }
+            }
+            else
+            {
+                position += step;
+            }
+        }
+    }
+}
+
+std::shared_ptr<const Resampler::FilterTable> Resampler::buildTable (int upFactor, int downFactor, Quality quality)
+{
+    auto settings = getSettings (quality);
+
+    // downFactor == 0 marks an approximated ratio; upFactor is then just the
+    // phase resolution and the real ratio is carried in the key by the caller
+    double ratio = (double) upFactor / (double) juce::jmax (1, downFactor);
+    double bandwidth = juce::jmin (1.0, ratio);
+
+    // Downsampling needs a proportionally longer kernel for the same steepness
+    int numTaps = (int) std::ceil (settings.baseTaps / bandwidth);
+    numTaps = juce::jlimit (8, 512, (numTaps + 7) & ~7);
+
+    auto table = std::make_shared<FilterTable>();
+    table->upFactor = upFactor;
+    table->downFactor = downFactor;
+    table->numTaps = numTaps;
+    table->coefficients.resize ((size_t) upFactor * (size_t) numTaps);
+
+    const double cutoff = bandwidth * settings.passband;    // relative to input Nyquist
+    const double halfWidth = numTaps / 2.0;
+    const double i0Beta = besselI0 (settings.kaiserBeta);
+
+    for (int phase = 0; phase < upFactor; ++phase)
+    {
+        auto* row = table->coefficients.data() + (size_t) phase * (size_t) numTaps;
+        double frac = (double) phase / (double) upFactor;
+        double total = 0.0;
+
+        for (int k = 0; k < numTaps; ++k)
+        {
+            double distance = (double) (k - (numTaps / 2 - 1)) - frac;
+            double x = distance * cutoff;
+            double sinc = std::abs (x) < 1.0e-9 ? 1.0 : std::sin (juce::MathConstants<double>::pi * x)
+                                                         / (juce::MathConstants<double>::pi * x);
+            double w = distance / halfWidth;
+            double window = std::abs (w) >= 1.0 ? 0.0
+                                                : besselI0 (settings.kaiserBeta * std::sqrt (1.0 - w * w)) / i0Beta;
+            double value = cutoff * sinc * window;
+            row[k] = (float) value;
+            total += value;
+        }
+
+        // Unity gain at DC for every phase
+        if (total != 0.0)
+            for (int k = 0; k < numTaps; ++k)
+                row[k] = (float) (row[k] / total);
+    }
+
+    return table;
+}
+
+std::shared_ptr<const Resampler::FilterTable> Resampler::getTable (double sourceRate, double targetRate, Quality quality)
+{
+    static std::mutex cacheMutex;
+    static std::map<std::tuple<int, juce::int64, juce::int64>, std::shared_ptr<const FilterTable>> cache;
+
+    auto source = (juce::int64) std::llround (sourceRate);
+    auto target = (juce::int64) std::llround (targetRate);
+    bool integral = std::abs (sourceRate - (double) source) < 1.0e-6
+                 && std::abs (targetRate - (double) target) < 1.0e-6;
+
+    int upFactor = kMaxPhases;
+    int downFactor = 0;
+
+    if (integral && source > 0 && target > 0)
+    {
+        auto divisor = std::gcd (source, target);
+        if (target / divisor <= kMaxPhases)
+        {
+            upFactor = (int) (target / divisor);
+            downFactor = (int) (source / divisor);
+        }
+    }
+
+    // Approximated ratios are keyed by the ratio itself, in millionths
+    auto key = downFactor > 0 ? std::make_tuple ((int) quality, (juce::int64) upFactor, (juce::int64) downFactor)
+                              : std::make_tuple ((int) quality, (juce::int64) 0,
+                                                 (juce::int64) std::llround (targetRate / sourceRate * 1.0e6));
+
+    std::lock_guard<std::mutex> lock (cacheMutex);
+
+    auto& entry = cache[key];
+    if (entry == nullptr)
+    {
+        if (downFactor > 0)
+        {
+            entry = buildTable (upFactor, downFactor, quality);
+        }
+        else
+        {
+            // Build with the real bandwidth, then mark the table as approximate
+            auto approxDown = (int) std::lround (kMaxPhases * sourceRate / targetRate);
+            auto built = std::const_pointer_cast<FilterTable> (buildTable (kMaxPhases, juce::jmax (1, approxDown), quality));
+            built->downFactor = 0;
+            entry = built;
+        }
+    }
+
+    return entry;
+}
+
+void Resampler::processChannels (const FilterTable& table,
+                                 const float* const* padded, int numChannels, int /*inputLength*/,
+                                 float* const* output, int outputLength,
+                                 double sourceRate, double targetRate)
+{
+    const bool exact = table.downFactor > 0;
+    const double step = sourceRate / targetRate;
+
+    int ch = 0;
+    for (; ch + 1 < numChannels; ch += 2)
+        convertGroup<2> (padded + ch, output + ch, outputLength, table.getPhase (0), table.numTaps,
+                         exact, table.upFactor, table.downFactor, step);
+
+    if (ch < numChannels)
+        convertGroup<1> (padded + ch, output + ch, outputLength, table.getPhase (0), table.numTaps,
+                         exact, table.upFactor, table.downFactor, step);
+}
+
+juce::AudioBuffer<float> Resampler::process (const juce::AudioBuffer<float>& source,
+                                             double sourceRate, double targetRate,
+                                             Quality quality)
+{
+    const int numChannels = source.getNumChannels();
+    const int inputLength = source.getNumSamples();
+
+    if (sourceRate <= 0 || targetRate <= 0 || numChannels == 0 || inputLength == 0)
+        return source;
+
+    auto table = getTable (sourceRate, targetRate, quality);
+
+    const int outputLength = (int) ((double) inputLength * targetRate / sourceRate);
+    const int pad = table->numTaps / 2;
+
+    // Zero padding on both sides lets the inner loop run without bounds checks
+    juce::AudioBuffer<float> padded (numChannels, inputLength + 2 * pad + 8);
+    padded.clear();
+    for (int ch = 0; ch < numChannels; ++ch)
+        padded.copyFrom (ch, pad, source, ch, 0, inputLength);
+
+    juce::AudioBuffer<float> result (numChannels, outputLength);
+    processChannels (*table, padded.getArrayOfReadPointers(), numChannels, inputLength,
+                     result.getArrayOfWritePointers(), outputLength, sourceRate, targetRate);
+    return result;
+}
+
+void Resampler::warmUp (double targetRate, Quality quality)
+{
+    for (double sourceRate : { 44100.0, 48000.0, 88200.0, 96000.0, 192000.0 })
+        if (sourceRate != targetRate)
+            getTable (sourceRate, targetRate, quality);
+}
+
+juce::String Resampler::getQualityName (Quality quality)
+{
+    switch (quality)
+    {
+        case Quality::fast:     return "Fast";
+        case Quality::high:     return "High";
+        case Quality::standard: break;
+    }
+
+    return "Standard";
+}
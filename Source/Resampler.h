@@ -0,0 +1,54 @@
+#pragma once
+#include <juce_audio_basics/juce_audio_basics.h>
+#include <memory>
+#include <vector>
+
+// Offline sample-rate conversion for decoded samples.
+//
+// Uses a polyphase Kaiser-windowed sinc filter. When both rates are whole
+// numbers with a small enough ratio, such as the 44.1/48/88.2/96/192 kHz
+// family, the filter has one phase per distinct output position and the
+// conversion is exact. Other ratios fall back to the nearest of
+// kMaxPhases phases. Filter tables are built once per (ratio, quality)
+// and shared.
+class Resampler
+{
+public:
+    enum class Quality
+    {
+        fast,       // 16 taps
+        standard,   // 32 taps
+        high        // 64 taps
+    };
+
+    static juce::AudioBuffer<float> process (const juce::AudioBuffer<float>& source,
+                                             double sourceRate, double targetRate,
+                                             Quality quality);
+
+    // Builds the tables for converting the common studio rates to targetRate,
+    // so the first kit load after a rate change doesn't pay for them.
+    static void warmUp (double targetRate, Quality quality);
+
+    static juce::String getQualityName (Quality quality);
+
+private:
+    static constexpr int kMaxPhases = 2048;
+
+    struct FilterTable
+    {
+        int upFactor = 1;       // L: output positions per input step cycle
+        int downFactor = 1;     // M: input samples advanced per L outputs
+        int numTaps = 0;        // multiple of 8, taps per phase
+        std::vector<float> coefficients;   // upFactor rows of numTaps
+
+        const float* getPhase (int phase) const noexcept { return coefficients.data() + (size_t) phase * (size_t) numTaps; }
+    };
+
+    static std::shared_ptr<const FilterTable> getTable (double sourceRate, double targetRate, Quality quality);
+    static std::shared_ptr<const FilterTable> buildTable (int upFactor, int downFactor, Quality quality);
+
+    static void processChannels (const FilterTable& table,
+                                 const float* const* padded, int numChannels, int inputLength,
+                                 float* const* output, int outputLength,
+                                 double sourceRate, double targetRate);
+};
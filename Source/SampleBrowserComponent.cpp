@@ -21,10 +21,12 @@ public:
             g.fillAll();
         }
 
+        treeItem.paintThumbnail (g, getWidth(), getHeight());
+
         g.setColour (DarkLookAndFeel::textBright);
         g.setFont (juce::FontOptions (12.0f));
         g.drawText (treeItem.getDisplayName(),
-                    juce::Rectangle<int> (4, 0, getWidth() - 8, getHeight()),
+                    juce::Rectangle<int> (4, 0, getWidth() - 12 - SampleTreeItem::kThumbnailWidth, getHeight()),
                     juce::Justification::centredLeft, true);
     }
 
@@ -75,19 +77,60 @@ private:
     bool popupTriggered = false;
 };
 
+//==============================================================================
+// PlaceholderTreeItem - "Loading..." row for a folder's children not shown yet
+//==============================================================================
+
+class PlaceholderTreeItem : public juce::TreeViewItem
+{
+public:
+    // With loadsMore set, drawing the row asks the folder for its next chunk
+    PlaceholderTreeItem (SampleTreeItem& folder, bool loadsMore)
+        : folderItem (folder), requestsChunk (loadsMore)
+    {
+    }
+
+    bool mightContainSubItems() override { return false; }
+    bool canBeSelected() const override { return false; }
+    int getItemHeight() const override { return 22; }
+
+    juce::String getUniqueName() const override
+    {
+        return folderItem.getFile().getFullPathName() + "|loading";
+    }
+
+    void paintItem (juce::Graphics& g, int width, int height) override
+    {
+        g.setColour (DarkLookAndFeel::textDim);
+        g.setFont (juce::FontOptions (12.0f, juce::Font::italic));
+        g.drawText ("Loading...", juce::Rectangle<int> (4, 0, width - 8, height),
+                    juce::Justification::centredLeft, true);
+
+        if (requestsChunk)
+        {
+            requestsChunk = false;
+            folderItem.getOwner().requestMoreChildren (folderItem.getFile());
+        }
+    }
+
+private:
+    SampleTreeItem& folderItem;
+    bool requestsChunk;
+};
+
 //==============================================================================
 // SampleTreeItem
 //==============================================================================
 
-SampleTreeItem::SampleTreeItem (const juce::File& f, SampleBrowserComponent& browser,
+SampleTreeItem::SampleTreeItem (const juce::File& f, SampleBrowserComponent& browser, bool folder,
                                 const juce::String& customDisplayName)
-    : file (f), owner (browser), displayName (customDisplayName)
+    : file (f), owner (browser), displayName (customDisplayName), isFolder (folder)
 {
 }
 
 bool SampleTreeItem::mightContainSubItems()
 {
-    return file.isDirectory();
+    return isFolder;
 }
 
 juce::String SampleTreeItem::getUniqueName() const
@@ -108,7 +151,7 @@ juce::String SampleTreeItem::getDisplayName() const
 
 void SampleTreeItem::paintItem (juce::Graphics& g, int width, int height)
 {
-    bool isDropTarget = file.isDirectory()
+    bool isDropTarget = isFolder
                         && owner.getHighlightedDropTarget() == file;
 
     if (isDropTarget)
@@ -126,7 +169,7 @@ void SampleTreeItem::paintItem (juce::Graphics& g, int width, int height)
 
     auto textArea = juce::Rectangle<int> (4, 0, width - 8, height);
 
-    if (file.isDirectory())
+    if (isFolder)
     {
         g.setColour (isDropTarget ? DarkLookAndFeel::accent.brighter (0.3f)
                                   : DarkLookAndFeel::accent);
@@ -134,6 +177,9 @@ void SampleTreeItem::paintItem (juce::Graphics& g, int width, int height)
     }
     else
     {
+        paintThumbnail (g, width, height);
+        textArea.removeFromRight (kThumbnailWidth + 4);
+
         g.setColour (DarkLookAndFeel::textBright);
         g.setFont (juce::FontOptions (12.0f));
     }
@@ -141,9 +187,21 @@ void SampleTreeItem::paintItem (juce::Graphics& g, int width, int height)
     g.drawText (getDisplayName(), textArea, juce::Justification::centredLeft, true);
 }
 
+void SampleTreeItem::paintThumbnail (juce::Graphics& g, int width, int height)
+{
+    if (isFolder || width < kThumbnailWidth * 3)
+        return;
+
+    if (auto thumbnail = owner.getThumbnails().get (file))
+    {
+        auto area = juce::Rectangle<int> (width - kThumbnailWidth - 4, 3, kThumbnailWidth, height - 6).toFloat();
+        thumbnail->draw (g, area, DarkLookAndFeel::accent.withAlpha (0.35f), DarkLookAndFeel::accent.withAlpha (0.6f));
+    }
+}
+
 void SampleTreeItem::itemOpennessChanged (bool isNowOpen)
 {
-    if (isNowOpen && ! hasScanned && file.isDirectory())
+    if (isNowOpen && ! hasScanned && ! isLoading && isFolder)
         scanDirectory();
 }
 
@@ -155,13 +213,13 @@ void SampleTreeItem::itemClicked (const juce::MouseEvent& e)
         return;
     }
 
-    if (! file.isDirectory() && isAudioFile (file))
+    if (! isFolder && isAudioFile (file))
         owner.getSampleEngine().previewSample (file);
 }
 
 juce::var SampleTreeItem::getDragSourceDescription()
 {
-    if (! file.isDirectory() && isAudioFile (file))
+    if (! isFolder && isAudioFile (file))
         return SampleBrowserComponent::dragSourceId + ":" + file.getFullPathName();
 
     return {};
@@ -169,7 +227,7 @@ juce::var SampleTreeItem::getDragSourceDescription()
 
 std::unique_ptr<juce::Component> SampleTreeItem::createItemComponent()
 {
-    if (! file.isDirectory() && isAudioFile (file))
+    if (! isFolder && isAudioFile (file))
         return std::make_unique<SampleFileItemComponent> (*this, owner);
 
     return nullptr;
@@ -177,34 +235,178 @@ std::unique_ptr<juce::Component> SampleTreeItem::createItemComponent()
 
 bool SampleTreeItem::isAudioFile (const juce::File& f)
 {
-    auto ext = f.getFileExtension().toLowerCase();
-    return ext == ".wav" || ext == ".aif" || ext == ".aiff" || ext == ".flac" || ext == ".mp3";
+    return SampleIndex::isAudioFile (f);
 }
 
 void SampleTreeItem::scanDirectory()
 {
+    // A cached listing is shown at once; the request checks it is current
+    if (auto cached = owner.getDirectoryLister().getCached (file))
+    {
+        setListing (cached);
+    }
+    else
+    {
+        isLoading = true;
+        clearSubItems();
+        addSubItem (new PlaceholderTreeItem (*this, false));
+    }
+
+    owner.requestListing (file);
+}
+
+void SampleTreeItem::setListing (DirectoryLister::ListingPtr newListing)
+{
+    isLoading = false;
+
+    if (newListing == nullptr || newListing == listing)
+        return;
+
+    auto openness = hasScanned ? getOpennessState() : nullptr;
+
+    listing = std::move (newListing);
     hasScanned = true;
+
     clearSubItems();
+    pendingChildren = listing->entries;
+    nextPending = 0;
+    addNextChunk();
+
+    if (openness != nullptr)
+        restoreOpennessState (*openness);
+}
+
+void SampleTreeItem::addNextChunk()
+{
+    if (! hasPendingChildren())
+        return;
 
-    auto children = file.findChildFiles (
-        juce::File::findFilesAndDirectories | juce::File::ignoreHiddenFiles, false);
+    removePlaceholder();
 
-    children.sort();
+    auto end = std::min (nextPending + kChildrenPerChunk, pendingChildren.size());
 
-    juce::Array<juce::File> dirs, audioFiles;
-    for (auto& child : children)
+    for (; nextPending < end; ++nextPending)
+        addSubItem (new SampleTreeItem (pendingChildren[nextPending].file, owner,
+                                        pendingChildren[nextPending].isFolder));
+
+    if (hasPendingChildren())
+    {
+        addSubItem (new PlaceholderTreeItem (*this, true));
+    }
+    else
     {
-        if (child.isDirectory())
-            dirs.add (child);
-        else if (isAudioFile (child))
-            audioFiles.add (child);
+        pendingChildren.clear();
+        nextPending = 0;
     }
+}
 
-    for (auto& d : dirs)
-        addSubItem (new SampleTreeItem (d, owner));
+void SampleTreeItem::removePlaceholder()
+{
+    auto last = getNumSubItems() - 1;
 
-    for (auto& f : audioFiles)
-        addSubItem (new SampleTreeItem (f, owner));
+    if (last >= 0 && dynamic_cast<PlaceholderTreeItem*> (getSubItem (last)) != nullptr)
+        removeSubItem (last);
+}
+
+SampleTreeItem* SampleTreeItem::findChild (const juce::File& child) const
+{
+    for (int i = 0; i < getNumSubItems(); ++i)
+        if (auto* item = dynamic_cast<SampleTreeItem*> (getSubItem (i)))
+            if (item->file == child)
+                return item;
+
+    return nullptr;
+}
+
+SampleTreeItem* SampleTreeItem::findOrCreateChild (const juce::File& child)
+{
+    if (auto* item = findChild (child))
+        return item;
+
+    auto pending = std::find_if (pendingChildren.begin() + (std::ptrdiff_t) nextPending, pendingChildren.end(),
+                                 [&child] (const DirectoryLister::Entry& e) { return e.file == child; });
+
+    if (pending == pendingChildren.end())
+        return nullptr;
+
+    while (hasPendingChildren())
+    {
+        addNextChunk();
+
+        if (auto* item = findChild (child))
+            return item;
+    }
+
+    return nullptr;
+}
+
+void SampleTreeItem::addChild (const juce::File& child)
+{
+    if (findChild (child) != nullptr || child.isHidden())
+        return;
+
+    auto isChild = [&child] (const DirectoryLister::Entry& e) { return e.file == child; };
+    if (std::any_of (pendingChildren.begin() + (std::ptrdiff_t) nextPending, pendingChildren.end(), isChild))
+        return;
+
+    bool childIsFolder = child.isDirectory();
+    if (! childIsFolder && ! isAudioFile (child))
+        return;
+
+    // Folders first, then files, each sorted
+    int index = 0;
+    for (; index < getNumSubItems(); ++index)
+    {
+        auto* sibling = dynamic_cast<SampleTreeItem*> (getSubItem (index));
+        if (sibling == nullptr)
+            continue;
+
+        if (childIsFolder != sibling->isFolder ? childIsFolder : child < sibling->file)
+            break;
+    }
+
+    // Past the items created so far, it waits with the rest
+    if (index == getNumSubItems() && hasPendingChildren())
+    {
+        auto pos = std::find_if (pendingChildren.begin() + (std::ptrdiff_t) nextPending, pendingChildren.end(),
+                                 [&] (const DirectoryLister::Entry& e)
+                                 {
+                                     return childIsFolder != e.isFolder ? childIsFolder : child < e.file;
+                                 });
+
+        pendingChildren.insert (pos, { child, childIsFolder });
+        return;
+    }
+
+    addSubItem (new SampleTreeItem (child, owner, childIsFolder), index);
+}
+
+void SampleTreeItem::removeChild (const juce::File& child)
+{
+    for (int i = 0; i < getNumSubItems(); ++i)
+    {
+        if (auto* item = dynamic_cast<SampleTreeItem*> (getSubItem (i)); item != nullptr && item->file == child)
+        {
+            removeSubItem (i);
+            return;
+        }
+    }
+
+    auto pending = std::find_if (pendingChildren.begin() + (std::ptrdiff_t) nextPending, pendingChildren.end(),
+                                 [&child] (const DirectoryLister::Entry& e) { return e.file == child; });
+
+    if (pending != pendingChildren.end())
+        pendingChildren.erase (pending);
+}
+
+// The current items stay until the new listing replaces them
+void SampleTreeItem::rescan()
+{
+    if (! hasScanned)
+        return;
+
+    owner.getDirectoryLister().forget (file);
+    owner.requestListing (file);
 }
 
 //==============================================================================
@@ -213,9 +415,19 @@ void SampleTreeItem::scanDirectory()
 
 const juce::String SampleBrowserComponent::dragSourceId = "MPSSampleDrag";
 
-SampleBrowserComponent::SampleBrowserComponent (SampleEngine& engine)
-    : sampleEngine (engine)
+SampleBrowserComponent::SampleBrowserComponent (SampleEngine& engine, SampleIndex& index)
+    : sampleEngine (engine), sampleIndex (index)
 {
+    sampleIndex.setResultsCallback ([safeThis = juce::Component::SafePointer<SampleBrowserComponent> (this)]
+                                    (int searchId, const juce::Array<juce::File>& files)
+    {
+        juce::MessageManager::callAsync ([safeThis, searchId, files]
+        {
+            if (safeThis != nullptr)
+                safeThis->addSearchResults (searchId, files);
+        });
+    });
+
     treeView.setColour (juce::TreeView::backgroundColourId, DarkLookAndFeel::bgDark);
     treeView.setColour (juce::TreeView::linesColourId, DarkLookAndFeel::bgLight);
     treeView.setColour (juce::TreeView::selectedItemBackgroundColourId,
@@ -246,12 +458,21 @@ SampleBrowserComponent::SampleBrowserComponent (SampleEngine& engine)
     clearSearchButton.setVisible (false);
     addAndMakeVisible (clearSearchButton);
 
-    refreshButton.onClick = [this] { refresh(); };
+    thumbnails->addChangeListener (this);
+
+    refreshButton.onClick = [this]
+    {
+        directoryLister->clear();
+        refresh();
+    };
     addAndMakeVisible (refreshButton);
 }
 
 SampleBrowserComponent::~SampleBrowserComponent()
 {
+    thumbnails->removeChangeListener (this);
+    sampleIndex.setResultsCallback (nullptr);
+    sampleIndex.cancelSearch();
     treeView.setRootItem (nullptr);
 }
 
@@ -273,6 +494,12 @@ void SampleBrowserComponent::resized()
     treeView.setBounds (area);
 }
 
+void SampleBrowserComponent::changeListenerCallback (juce::ChangeBroadcaster*)
+{
+    // A thumbnail arrived; only the visible rows are repainted
+    treeView.repaint();
+}
+
 void SampleBrowserComponent::paint (juce::Graphics& g)
 {
     g.fillAll (DarkLookAndFeel::bgDark);
@@ -311,18 +538,28 @@ void SampleBrowserComponent::paint (juce::Graphics& g)
 
 void SampleBrowserComponent::setSamplesDirectory (const juce::File& dir)
 {
+    // Kept current by applyChanges, so showing the browser again needn't re-read it
+    if (dir == samplesDir && rootItem != nullptr)
+        return;
+
     samplesDir = dir;
     refresh();
 }
 
 void SampleBrowserComponent::refresh()
 {
+    if (currentSearchId != 0)
+    {
+        sampleIndex.cancelSearch();
+        currentSearchId = 0;
+    }
+
     treeView.setRootItem (nullptr);
     rootItem.reset();
 
     if (samplesDir.isDirectory())
     {
-        rootItem = std::make_unique<SampleTreeItem> (samplesDir, *this);
+        rootItem = std::make_unique<SampleTreeItem> (samplesDir, *this, true);
         treeView.setRootItem (rootItem.get());
         rootItem->setOpen (true);
         treeView.setRootItemVisible (false);
@@ -331,6 +568,8 @@ void SampleBrowserComponent::refresh()
 
 void SampleBrowserComponent::revealFile (const juce::File& file)
 {
+    pendingReveal = juce::File();
+
     if (rootItem == nullptr || ! file.existsAsFile())
         return;
 
@@ -344,26 +583,21 @@ void SampleBrowserComponent::revealFile (const juce::File& file)
     juce::StringArray pathParts;
     pathParts.addTokens (relativePath, juce::File::getSeparatorString(), "");
 
-    juce::TreeViewItem* current = rootItem.get();
+    auto* current = rootItem.get();
 
-    for (int i = 0; i < pathParts.size(); ++i)
+    for (auto& part : pathParts)
     {
         current->setOpen (true);
 
-        bool found = false;
-        for (int j = 0; j < current->getNumSubItems(); ++j)
+        // Picked up again by applyListing once the folder is listed
+        if (! current->hasBeenScanned())
         {
-            auto* child = current->getSubItem (j);
-            auto* treeItem = dynamic_cast<SampleTreeItem*> (child);
-            if (treeItem != nullptr && treeItem->getFile().getFileName() == pathParts[i])
-            {
-                current = child;
-                found = true;
-                break;
-            }
+            pendingReveal = file;
+            return;
         }
 
-        if (! found)
+        current = current->findOrCreateChild (current->getFile().getChildFile (part));
+        if (current == nullptr)
             return;
     }
 
@@ -451,10 +685,14 @@ void SampleBrowserComponent::filesDropped (const juce::StringArray& files, int x
 
     auto doCopy = [safeThis, audioFiles, dirPaths, targetDir]()
     {
+        std::vector<DirectoryWatcher::Change> changes;
+
         for (auto& path : dirPaths)
         {
             juce::File src (path);
-            src.copyDirectoryTo (targetDir.getChildFile (src.getFileName()));
+            auto dest = targetDir.getChildFile (src.getFileName());
+            src.copyDirectoryTo (dest);
+            changes.push_back ({ DirectoryWatcher::Change::Type::created, dest, true });
         }
 
         juce::File lastCopiedFile;
@@ -465,11 +703,14 @@ void SampleBrowserComponent::filesDropped (const juce::StringArray& files, int x
             auto dest = targetDir.getChildFile (src.getFileName());
             src.copyFileTo (dest);
             lastCopiedFile = dest;
+            changes.push_back ({ DirectoryWatcher::Change::Type::created, dest, false });
         }
 
+        // Shown straight away; the watcher's report of the same files
+        // changes nothing
         if (safeThis != nullptr)
         {
-            safeThis->refresh();
+            safeThis->applyChanges ({ safeThis->samplesDir, std::move (changes) });
 
             if (lastCopiedFile.existsAsFile())
                 safeThis->revealFile (lastCopiedFile);
@@ -529,6 +770,50 @@ void SampleBrowserComponent::updateDropTargetHighlight (int x, int y)
     }
 }
 
+//==============================================================================
+// Folder listing
+//==============================================================================
+
+void SampleBrowserComponent::requestListing (const juce::File& dir)
+{
+    auto safeThis = juce::Component::SafePointer<SampleBrowserComponent> (this);
+
+    directoryLister->list (dir, [safeThis, dir] (DirectoryLister::ListingPtr listing)
+    {
+        if (safeThis != nullptr)
+            safeThis->applyListing (dir, std::move (listing));
+    });
+}
+
+// Called while the tree paints, so the items are added afterwards
+void SampleBrowserComponent::requestMoreChildren (const juce::File& dir)
+{
+    auto safeThis = juce::Component::SafePointer<SampleBrowserComponent> (this);
+
+    juce::MessageManager::callAsync ([safeThis, dir]
+    {
+        if (safeThis != nullptr)
+            if (auto* item = safeThis->findItem (dir))
+                item->addNextChunk();
+    });
+}
+
+void SampleBrowserComponent::applyListing (const juce::File& dir, DirectoryLister::ListingPtr listing)
+{
+    // Search results replaced the tree the listing was for
+    if (currentSearchId != 0)
+        return;
+
+    auto* item = findItem (dir);
+    if (item == nullptr)
+        return;
+
+    item->setListing (std::move (listing));
+
+    if (pendingReveal != juce::File())
+        revealFile (pendingReveal);
+}
+
 //==============================================================================
 // Search
 //==============================================================================
@@ -549,27 +834,33 @@ void SampleBrowserComponent::performSearch()
 
     treeView.setRootItem (nullptr);
     rootItem.reset();
+    searchResultFiles.clear();
 
     if (! samplesDir.isDirectory())
+    {
+        sampleIndex.cancelSearch();
+        currentSearchId = 0;
         return;
+    }
 
-    rootItem = std::make_unique<SampleTreeItem> (samplesDir, *this);
+    rootItem = std::make_unique<SampleTreeItem> (samplesDir, *this, true);
     rootItem->markAsScanned();
     treeView.setRootItem (rootItem.get());
     treeView.setRootItemVisible (false);
     rootItem->setOpen (true);
 
-    auto allFiles = samplesDir.findChildFiles (juce::File::findFiles, true);
-    auto lowerText = text.toLowerCase();
+    // Matches arrive in batches from the index thread; see addSearchResults
+    currentSearchId = sampleIndex.search (text);
+}
 
-    for (auto& f : allFiles)
-    {
-        if (! SampleTreeItem::isAudioFile (f))
-            continue;
+void SampleBrowserComponent::addSearchResults (int searchId, const juce::Array<juce::File>& files)
+{
+    if (searchId != currentSearchId || rootItem == nullptr)
+        return;
 
-        if (f.getFileNameWithoutExtension().toLowerCase().contains (lowerText))
-            rootItem->addSubItem (new SampleTreeItem (f, *this));
-    }
+    for (auto& f : files)
+        if (searchResultFiles.insert (f).second)
+            rootItem->addSubItem (new SampleTreeItem (f, *this, false));
 }
 
 void SampleBrowserComponent::refreshAfterChange()
@@ -580,6 +871,130 @@ void SampleBrowserComponent::refreshAfterChange()
         refresh();
 }
 
+//==============================================================================
+// File changes
+//==============================================================================
+
+void SampleBrowserComponent::applyChanges (const DirectoryWatcher::ChangeSet& changeSet)
+{
+    if (changeSet.root != samplesDir || rootItem == nullptr)
+        return;
+
+    if (changeSet.overflowed)
+    {
+        directoryLister->clear();
+        refreshAfterChange();
+        return;
+    }
+
+    auto query = searchField.getText().trim();
+    bool searchAgain = false;
+
+    for (auto& change : changeSet.changes)
+    {
+        if (! change.isDirectory && change.type != DirectoryWatcher::Change::Type::created)
+            thumbnails->forget (change.file);
+
+        if (query.isNotEmpty())
+            searchAgain = applyToSearchResults (change, query) || searchAgain;
+        else
+            applyToTree (change);
+    }
+
+    // The index applies the change sets queued before a search ahead of it,
+    // so the new files come back without listing them here
+    if (searchAgain)
+        currentSearchId = sampleIndex.search (query);
+}
+
+SampleTreeItem* SampleBrowserComponent::findLoadedItem (const juce::File& dir) const
+{
+    auto* item = findItem (dir);
+    return item != nullptr && item->hasBeenScanned() ? item : nullptr;
+}
+
+SampleTreeItem* SampleBrowserComponent::findItem (const juce::File& dir) const
+{
+    if (rootItem == nullptr || (dir != samplesDir && ! dir.isAChildOf (samplesDir)))
+        return nullptr;
+
+    juce::StringArray pathParts;
+    if (dir != samplesDir)
+        pathParts.addTokens (dir.getRelativePathFrom (samplesDir), juce::File::getSeparatorString(), "");
+
+    auto* current = rootItem.get();
+
+    for (auto& part : pathParts)
+    {
+        if (! current->hasBeenScanned())
+            return nullptr;
+
+        current = current->findChild (current->getFile().getChildFile (part));
+        if (current == nullptr)
+            return nullptr;
+    }
+
+    return current;
+}
+
+void SampleBrowserComponent::applyToTree (const DirectoryWatcher::Change& change)
+{
+    // Directories that haven't been opened yet are read when they are
+    auto* parent = findLoadedItem (change.file.getParentDirectory());
+    if (parent == nullptr)
+        return;
+
+    if (change.type == DirectoryWatcher::Change::Type::deleted)
+    {
+        parent->removeChild (change.file);
+        return;
+    }
+
+    if (auto* existing = parent->findChild (change.file))
+    {
+        if (change.isDirectory)
+            existing->rescan();
+        else
+            existing->repaintItem();
+    }
+    else
+    {
+        parent->addChild (change.file);
+    }
+}
+
+// Returns true if the change added a directory, whose files the search has
+// to be run again to find
+bool SampleBrowserComponent::applyToSearchResults (const DirectoryWatcher::Change& change,
+                                                   const juce::String& query)
+{
+    // Results are a flat list of files; a directory change replaces all of
+    // its files
+    if (change.isDirectory || change.type == DirectoryWatcher::Change::Type::deleted)
+    {
+        for (int i = rootItem->getNumSubItems(); --i >= 0;)
+        {
+            auto* item = dynamic_cast<SampleTreeItem*> (rootItem->getSubItem (i));
+            if (item != nullptr && (item->getFile() == change.file || item->getFile().isAChildOf (change.file)))
+            {
+                searchResultFiles.erase (item->getFile());
+                rootItem->removeSubItem (i);
+            }
+        }
+    }
+
+    if (change.type == DirectoryWatcher::Change::Type::deleted)
+        return false;
+
+    if (change.isDirectory)
+        return true;
+
+    if (SampleIndex::matches (samplesDir, change.file, query) && searchResultFiles.insert (change.file).second)
+        rootItem->addSubItem (new SampleTreeItem (change.file, *this, false));
+
+    return false;
+}
+
 //==============================================================================
 // Context menu, delete, move
 //==============================================================================
@@ -661,7 +1076,8 @@ void SampleBrowserComponent::deleteItem (const juce::File& file)
                     file.deleteFile();
 
                 if (safeThis != nullptr)
-                    safeThis->refreshAfterChange();
+                    safeThis->applyChanges ({ safeThis->samplesDir,
+                                              { { DirectoryWatcher::Change::Type::deleted, file, isDir } } });
             }
 
             delete alert;
@@ -671,6 +1087,11 @@ void SampleBrowserComponent::deleteItem (const juce::File& file)
 void SampleBrowserComponent::moveItem (const juce::File& source, const juce::File& targetDir)
 {
     auto dest = targetDir.getChildFile (source.getFileName());
+    bool isDir = source.isDirectory();
+
+    DirectoryWatcher::ChangeSet moved { samplesDir,
+                                        { { DirectoryWatcher::Change::Type::deleted, source, isDir },
+                                          { DirectoryWatcher::Change::Type::created, dest, isDir } } };
 
     if (dest.exists())
     {
@@ -684,7 +1105,7 @@ void SampleBrowserComponent::moveItem (const juce::File& source, const juce::Fil
         auto safeThis = juce::Component::SafePointer<SampleBrowserComponent> (this);
 
         alert->enterModalState (true, juce::ModalCallbackFunction::create (
-            [safeThis, source, dest, alert] (int result)
+            [safeThis, source, dest, moved, alert] (int result)
             {
                 if (result == 1 && safeThis != nullptr)
                 {
@@ -694,7 +1115,7 @@ void SampleBrowserComponent::moveItem (const juce::File& source, const juce::Fil
                         dest.deleteFile();
 
                     source.moveFileTo (dest);
-                    safeThis->refreshAfterChange();
+                    safeThis->applyChanges (moved);
                 }
 
                 delete alert;
@@ -703,7 +1124,7 @@ void SampleBrowserComponent::moveItem (const juce::File& source, const juce::Fil
     }
 
     source.moveFileTo (dest);
-    refreshAfterChange();
+    applyChanges (moved);
 }
 
 juce::Array<juce::File> SampleBrowserComponent::collectTargetFolders (
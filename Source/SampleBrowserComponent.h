@@ -1,14 +1,19 @@
 #pragma once
 #include <juce_gui_extra/juce_gui_extra.h>
+#include "DirectoryLister.h"
+#include "DirectoryWatcher.h"
 #include "SampleEngine.h"
+#include "SampleIndex.h"
+#include "ThumbnailCache.h"
 #include "LookAndFeel.h"
+#include <set>
 
 class SampleBrowserComponent;
 
 class SampleTreeItem : public juce::TreeViewItem
 {
 public:
-    SampleTreeItem (const juce::File& f, SampleBrowserComponent& browser,
+    SampleTreeItem (const juce::File& f, SampleBrowserComponent& browser, bool isFolder,
                     const juce::String& customDisplayName = {});
 
     bool mightContainSubItems() override;
@@ -22,17 +27,48 @@ public:
     bool canBeSelected() const override { return true; }
 
     const juce::File& getFile() const { return file; }
+    SampleBrowserComponent& getOwner() const { return owner; }
     juce::String getDisplayName() const;
     static bool isAudioFile (const juce::File& f);
+
+    // The waveform at the right-hand end of an audio file's row, once the
+    // browser's ThumbnailCache has it.
+    void paintThumbnail (juce::Graphics& g, int width, int height);
+    static constexpr int kThumbnailWidth = 48;
     void markAsScanned() { hasScanned = true; }
+    bool hasBeenScanned() const { return hasScanned; }
+
+    // Folders are listed in the background, showing a placeholder until the
+    // listing arrives. Its items are then created kChildrenPerChunk at a
+    // time, the next chunk when the placeholder after the last one is drawn.
+    void setListing (DirectoryLister::ListingPtr newListing);
+    void addNextChunk();
+
+    static constexpr size_t kChildrenPerChunk = 200;
+
+    // Patching after a reported change, without re-reading the directory.
+    // addChild puts the item where scanDirectory would have.
+    SampleTreeItem* findChild (const juce::File& child) const;
+    SampleTreeItem* findOrCreateChild (const juce::File& child);
+    void addChild (const juce::File& child);
+    void removeChild (const juce::File& child);
+    void rescan();
 
 private:
     juce::File file;
     SampleBrowserComponent& owner;
     juce::String displayName;
+    bool isFolder = false;
     bool hasScanned = false;
+    bool isLoading = false;
+
+    DirectoryLister::ListingPtr listing;
+    std::vector<DirectoryLister::Entry> pendingChildren;    // not created yet, from nextPending on
+    size_t nextPending = 0;
 
     void scanDirectory();
+    bool hasPendingChildren() const { return nextPending < pendingChildren.size(); }
+    void removePlaceholder();
 };
 
 class SampleTreeView : public juce::TreeView
@@ -42,10 +78,11 @@ public:
 };
 
 class SampleBrowserComponent : public juce::Component,
-                                public juce::FileDragAndDropTarget
+                                public juce::FileDragAndDropTarget,
+                                private juce::ChangeListener
 {
 public:
-    SampleBrowserComponent (SampleEngine& engine);
+    SampleBrowserComponent (SampleEngine& engine, SampleIndex& index);
     ~SampleBrowserComponent() override;
 
     void resized() override;
@@ -55,6 +92,10 @@ public:
     void refresh();
     void revealFile (const juce::File& file);
 
+    // Patches the tree, or the search results, with changes reported under
+    // the samples directory.
+    void applyChanges (const DirectoryWatcher::ChangeSet& changeSet);
+
     bool isInterestedInFileDrag (const juce::StringArray& files) override;
     void fileDragEnter (const juce::StringArray& files, int x, int y) override;
     void fileDragMove (const juce::StringArray& files, int x, int y) override;
@@ -62,6 +103,12 @@ public:
     void filesDropped (const juce::StringArray& files, int x, int y) override;
 
     SampleEngine& getSampleEngine() { return sampleEngine; }
+    DirectoryLister& getDirectoryLister() { return *directoryLister; }
+    ThumbnailCache& getThumbnails() { return *thumbnails; }
+
+    // Lists dir in the background and hands the result to its item
+    void requestListing (const juce::File& dir);
+    void requestMoreChildren (const juce::File& dir);
     juce::File getSamplesDirectory() const { return samplesDir; }
     juce::File getHighlightedDropTarget() const { return highlightedDropTarget; }
 
@@ -71,7 +118,11 @@ public:
 
 private:
     SampleEngine& sampleEngine;
+    SampleIndex& sampleIndex;
+    juce::SharedResourcePointer<DirectoryLister> directoryLister;
+    juce::SharedResourcePointer<ThumbnailCache> thumbnails;
     juce::File samplesDir;
+    juce::File pendingReveal;   // waiting for a folder on its path to be listed
 
     SampleTreeView treeView;
     std::unique_ptr<SampleTreeItem> rootItem;
@@ -80,13 +131,23 @@ private:
     juce::TextButton clearSearchButton { "x" };
     juce::TextButton refreshButton { "Refresh" };
 
+    int currentSearchId = 0;    // 0 when the tree isn't showing search results
+    std::set<juce::File> searchResultFiles;     // already shown, so a file is never listed twice
+
     bool fileDragActive = false;
     juce::File highlightedDropTarget;
 
     juce::File getDropTargetDirectory (int x, int y) const;
     void updateDropTargetHighlight (int x, int y);
+    void changeListenerCallback (juce::ChangeBroadcaster*) override;
     void performSearch();
+    void addSearchResults (int searchId, const juce::Array<juce::File>& files);
     void refreshAfterChange();
+    SampleTreeItem* findItem (const juce::File& dir) const;
+    SampleTreeItem* findLoadedItem (const juce::File& dir) const;
+    void applyListing (const juce::File& dir, DirectoryLister::ListingPtr listing);
+    void applyToTree (const DirectoryWatcher::Change& change);
+    bool applyToSearchResults (const DirectoryWatcher::Change& change, const juce::String& query);
     void deleteItem (const juce::File& file);
     void moveItem (const juce::File& source, const juce::File& targetDir);
     juce::Array<juce::File> collectTargetFolders (const juce::File& excludeItem) const;
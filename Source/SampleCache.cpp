@@ -0,0 +1,232 @@
+#include "SampleCache.h"
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+namespace
+{
+    constexpr char kMagic[4] = { 'B', 'W', 'S', 'C' };
+    constexpr juce::uint32 kVersion = 1;
+    constexpr int kHashedBytes = 64 * 1024;
+
+    struct FileHeader
+    {
+        char magic[4];
+        juce::uint32 version;
+        juce::uint32 numChannels;
+        juce::uint32 quality;
+        juce::int64 numSamples;
+        double sampleRate;
+        juce::int64 sourceSize;
+        juce::int64 sourceModificationTime;
+        juce::uint64 sourceContentHash;
+        juce::uint64 dataOffset;    // channel data starts here, one channel after another
+    };
+
+    static_assert (sizeof (FileHeader) == 64, "Cache header layout changed");
+
+    // FNV-1a, enough to tell files apart; this isn't a security boundary
+    juce::uint64 hashBytes (const void* data, size_t numBytes, juce::uint64 hash = 0xcbf29ce484222325ull)
+    {
+        auto* bytes = static_cast<const juce::uint8*> (data);
+        for (size_t i = 0; i < numBytes; ++i)
+        {
+            hash ^= bytes[i];
+            hash *= 0x100000001b3ull;
+        }
+        return hash;
+    }
+
+    // Reads one byte from every page, so the disk reads of a fresh mapping
+    // happen here rather than on the first block that plays it
+    void faultInPages (const char* data, size_t numBytes) noexcept
+    {
+        constexpr size_t kPageSize = 4096;
+
+        volatile char sink = 0;
+        for (size_t offset = 0; offset < numBytes; offset += kPageSize)
+            sink = sink + data[offset];
+
+        if (numBytes > 0)
+            sink = sink + data[numBytes - 1];
+    }
+
+    juce::uint64 hashFileContent (const juce::File& file, juce::int64 size)
+    {
+        juce::FileInputStream in (file);
+        if (! in.openedOk())
+            return 0;
+
+        juce::HeapBlock<char> block (kHashedBytes);
+        auto hash = hashBytes (&size, sizeof (size));
+
+        auto numRead = in.read (block, kHashedBytes);
+        hash = hashBytes (block, (size_t) juce::jmax (0, numRead), hash);
+
+        if (size > kHashedBytes && in.setPosition (juce::jmax ((juce::int64) kHashedBytes, size - kHashedBytes)))
+        {
+            numRead = in.read (block, kHashedBytes);
+            hash = hashBytes (block, (size_t) juce::jmax (0, numRead), hash);
+        }
+
+        return hash;
+    }
+}
+
+SampleCache::SampleCache()
+{
+    auto appData = juce::File::getSpecialLocation (juce::File::userApplicationDataDirectory);
+    directory = appData.getChildFile ("Beatwerk/SampleCache");
+}
+
+std::optional<SampleCache::Key> SampleCache::makeKey (const juce::File& source, double sampleRate,
+                                                      Resampler::Quality quality)
+{
+    if (! source.existsAsFile())
+        return std::nullopt;
+
+    Key key;
+    key.path = source.getFullPathName();
+    key.size = source.getSize();
+    key.modificationTime = source.getLastModificationTime().toMilliseconds();
+    key.contentHash = hashFileContent (source, key.size);
+    key.sampleRate = sampleRate;
+    key.quality = quality;
+    return key;
+}
+
+juce::File SampleCache::getFileFor (const Key& key) const
+{
+    auto path = key.path.toStdString();
+    auto quality = (int) key.quality;
+
+    auto hash = hashBytes (path.data(), path.size());
+    hash = hashBytes (&key.size, sizeof (key.size), hash);
+    hash = hashBytes (&key.modificationTime, sizeof (key.modificationTime), hash);
+    hash = hashBytes (&key.contentHash, sizeof (key.contentHash), hash);
+    hash = hashBytes (&key.sampleRate, sizeof (key.sampleRate), hash);
+    hash = hashBytes (&quality, sizeof (quality), hash);
+
+    return directory.getChildFile (juce::String::toHexString ((juce::int64) hash) + ".bwsc");
+}
+
+std::optional<SampleCache::Entry> SampleCache::read (const Key& key) const
+{
+    auto file = getFileFor (key);
+    if (! file.existsAsFile())
+        return std::nullopt;
+
+    auto mapping = std::make_unique<juce::MemoryMappedFile> (file, juce::MemoryMappedFile::readOnly);
+    auto* base = static_cast<const char*> (mapping->getData());
+    if (base == nullptr || mapping->getSize() < sizeof (FileHeader))
+        return std::nullopt;
+
+    FileHeader header;
+    std::memcpy (&header, base, sizeof (header));
+
+    if (std::memcmp (header.magic, kMagic, sizeof (kMagic)) != 0
+        || header.version != kVersion
+        || header.numChannels == 0 || header.numChannels > 64
+        || header.numSamples <= 0 || header.numSamples > std::numeric_limits<int>::max()
+        || header.quality != (juce::uint32) key.quality
+        || header.sampleRate != key.sampleRate
+        || header.sourceSize != key.size
+        || header.sourceModificationTime != key.modificationTime
+        || header.sourceContentHash != key.contentHash
+        || header.dataOffset % sizeof (float) != 0)
+        return std::nullopt;
+
+    auto dataBytes = (size_t) header.numChannels * (size_t) header.numSamples * sizeof (float);
+    if (mapping->getSize() != header.dataOffset + dataBytes)
+        return std::nullopt;
+
+    faultInPages (base + header.dataOffset, dataBytes);
+
+    // The buffer is never written; SampleData is immutable once published
+    float* channels[64];
+    auto* samples = const_cast<float*> (reinterpret_cast<const float*> (base + header.dataOffset));
+    for (juce::uint32 ch = 0; ch < header.numChannels; ++ch)
+        channels[ch] = samples + (size_t) ch * (size_t) header.numSamples;
+
+    Entry entry;
+    entry.buffer = juce::AudioBuffer<float> (channels, (int) header.numChannels, (int) header.numSamples);
+    entry.mapping = std::move (mapping);
+    entry.sampleRate = header.sampleRate;
+
+    // Modification time doubles as the last-used time for pruning
+    file.setLastModificationTime (juce::Time::getCurrentTime());
+
+    return entry;
+}
+
+void SampleCache::write (const Key& key, const juce::AudioBuffer<float>& buffer, double sampleRate)
+{
+    if (buffer.getNumChannels() == 0 || buffer.getNumChannels() > 64 || buffer.getNumSamples() == 0)
+        return;
+
+    if (! directory.createDirectory())
+        return;
+
+    FileHeader header {};
+    std::memcpy (header.magic, kMagic, sizeof (kMagic));
+    header.version = kVersion;
+    header.numChannels = (juce::uint32) buffer.getNumChannels();
+    header.quality = (juce::uint32) key.quality;
+    header.numSamples = buffer.getNumSamples();
+    header.sampleRate = sampleRate;
+    header.sourceSize = key.size;
+    header.sourceModificationTime = key.modificationTime;
+    header.sourceContentHash = key.contentHash;
+    header.dataOffset = sizeof (FileHeader);
+
+    // Written under a temporary name, so a reader never maps a partial entry
+    auto file = getFileFor (key);
+    juce::TemporaryFile temp (file);
+    {
+        juce::FileOutputStream out (temp.getFile());
+        if (! out.openedOk())
+            return;
+
+        out.write (&header, sizeof (header));
+        for (int ch = 0; ch < buffer.getNumChannels(); ++ch)
+            out.write (buffer.getReadPointer (ch), (size_t) buffer.getNumSamples() * sizeof (float));
+
+        out.flush();
+        if (out.getStatus().failed())
+            return;
+    }
+
+    if (temp.overwriteTargetFileWithTemporary())
+        prune();
+}
+
+void SampleCache::prune()
+{
+    std::lock_guard<std::mutex> lock (pruneMutex);
+
+    auto files = directory.findChildFiles (juce::File::findFiles, false, "*.bwsc");
+
+    juce::int64 total = 0;
+    for (auto& f : files)
+        total += f.getSize();
+
+    if (total <= kMaxCacheBytes)
+        return;
+
+    std::sort (files.begin(), files.end(), [] (const juce::File& a, const juce::File& b)
+    {
+        return a.getLastModificationTime() < b.getLastModificationTime();
+    });
+
+    // Entries mapped by a loaded sample stay readable after deletion on
+    // POSIX; on Windows the delete fails and the entry survives this pass
+    for (auto& f : files)
+    {
+        if (total <= kMaxCacheBytes * 3 / 4)
+            break;
+
+        auto size = f.getSize();
+        if (f.deleteFile())
+            total -= size;
+    }
+}
@@ -0,0 +1,55 @@
+#pragma once
+#include <juce_audio_basics/juce_audio_basics.h>
+#include "Resampler.h"
+#include <memory>
+#include <mutex>
+#include <optional>
+
+// On-disk cache of decoded, already-resampled sample data.
+//
+// Entries are keyed by the source file's identity (path, size, modification
+// time and a hash of its first and last 64 KB) plus the target rate and
+// resampling quality. Each entry is one file: a 64-byte header followed by
+// planar 32-bit float channels, so a cache hit is a memory map with no
+// decoding or copying. Least recently used entries are pruned once the cache
+// grows past kMaxCacheBytes.
+class SampleCache
+{
+public:
+    SampleCache();
+
+    struct Key
+    {
+        juce::String path;
+        juce::int64 size = 0;
+        juce::int64 modificationTime = 0;
+        juce::uint64 contentHash = 0;
+        double sampleRate = 0.0;
+        Resampler::Quality quality = Resampler::Quality::standard;
+    };
+
+    // Empty if the source file can't be read.
+    static std::optional<Key> makeKey (const juce::File& source, double sampleRate, Resampler::Quality quality);
+
+    struct Entry
+    {
+        std::unique_ptr<juce::MemoryMappedFile> mapping;
+        juce::AudioBuffer<float> buffer;    // refers to the mapped pages, read-only
+        double sampleRate = 0.0;
+    };
+
+    // The mapped pages are read through before this returns, so call it off
+    // the audio thread. The OS may still drop them again under memory
+    // pressure; copy the buffer out where that matters.
+    std::optional<Entry> read (const Key& key) const;
+    void write (const Key& key, const juce::AudioBuffer<float>& buffer, double sampleRate);
+
+    static constexpr juce::int64 kMaxCacheBytes = (juce::int64) 2 * 1024 * 1024 * 1024;
+
+private:
+    juce::File directory;
+    std::mutex pruneMutex;
+
+    juce::File getFileFor (const Key& key) const;
+    void prune();
+};
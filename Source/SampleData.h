@@ -0,0 +1,20 @@
+#pragma once
+#include <juce_audio_basics/juce_audio_basics.h>
+#include "MixKernels.h"
+#include <memory>
+
+// Decoded audio for one pad. Never modified after it has been published to
+// a slot; replacing a pad's sample publishes a new object instead.
+struct SampleData : public juce::ReferenceCountedObject
+{
+    using Ptr = juce::ReferenceCountedObjectPtr<SampleData>;
+
+    std::unique_ptr<juce::MemoryMappedFile> mappedFile;    // backs buffer when it came from the cache
+    juce::AudioBuffer<float> buffer;
+    juce::String name;
+    juce::File file;
+    double sampleRate = 44100.0;    // rate the buffer was converted to
+    MixKernels::Row mixers;
+    bool pooled = false;            // also referenced by SamplePool until nothing else is
+    bool resident = false;          // held in heap memory even on a cache hit, so it never pages
+};
@@ -1,74 +1,395 @@
 #include "SampleEngine.h"
+#include <bit>
+
+namespace
+{
+    // Linear-interpolating playback for data whose rate doesn't match the
+    // output yet. Only used for the few blocks between a sample-rate change
+    // and the background re-conversion reaching the pad.
+    void mixInterpolated (float* const* dst, int dstChannels, const float* const* src, int srcLength,
+                          int& position, double& fraction, double step,
+                          int numSamples, float startGain, float endGain) noexcept
+    {
+        const float gainStep = (endGain - startGain) / (float) numSamples;
+
+        for (int i = 0; i < numSamples && position < srcLength; ++i)
+        {
+            const int next = juce::jmin (position + 1, srcLength - 1);
+            const float frac = (float) fraction;
+            const float gain = startGain + gainStep * (float) i;
+
+            dst[0][i] += (src[0][position] + (src[0][next] - src[0][position]) * frac) * gain;
+            if (dstChannels == 2)
+                dst[1][i] += (src[1][position] + (src[1][next] - src[1][position]) * frac) * gain;
+
+            fraction += step;
+            const int whole = (int) fraction;
+            position += whole;
+            fraction -= whole;
+        }
+    }
+}
 
 SampleEngine::SampleEngine()
 {
     formatManager.registerBasicFormats();
+
+    activeBankOwner = new KitBank();
+    activeBank.store (activeBankOwner.get());
+    stagedVolumes.fill (1.0f);
+    padVolumes.fill (1.0f);
+
+    backgroundThread.addTimeSliceClient (this);
+    backgroundThread.startThread (juce::Thread::Priority::low);
+}
+
+SampleEngine::~SampleEngine()
+{
+    backgroundThread.removeTimeSliceClient (this);
+    backgroundThread.stopThread (5000);
 }
 
-void SampleEngine::prepareToPlay (double sampleRate, int /*samplesPerBlock*/)
+void SampleEngine::prepareToPlay (double sampleRate, int samplesPerBlock)
 {
-    currentSampleRate = sampleRate;
+    auto previousRate = currentSampleRate.exchange (sampleRate);
+    preview.prepareToPlay (sampleRate, samplesPerBlock);
+
+    // Build the filter tables for the common source rates in the background,
+    // so the next kit load doesn't pay for them
+    if (previousRate != sampleRate)
+    {
+        auto quality = resampleQuality.load();
+        juce::Thread::launch ([sampleRate, quality] { Resampler::warmUp (sampleRate, quality); });
+
+        requestReconversion();
+    }
 }
 
 void SampleEngine::releaseResources()
 {
+    // Playback has stopped, so the voices can be reset directly. Queued
+    // volumes still apply; queued notes are dropped with the voices.
+    applyPendingCommands();
+
     for (auto& slot : slots)
+    {
+        slot.activeVoices.store (0);
+        slot.stoppedVoices.store (0);
         for (auto& voice : slot.voices)
-            voice.active.store (false);
+            voice.sample = nullptr;
+    }
+
+    for (auto& word : activeSlots)
+        word.store (0);
+
+    preview.releaseResources();
 }
 
-void SampleEngine::loadSample (int midiNote, const juce::File& file)
+SampleData::Ptr SampleEngine::decodeSample (const juce::File& file, bool resident)
 {
-    if (midiNote < 0 || midiNote >= kTotalSlots)
-        return;
+    const double targetRate = currentSampleRate.load();
+    const auto quality = resampleQuality.load();
+
+    if (! resident)
+        if (auto held = samplePool->find (file, targetRate, quality, true))
+            return held;
+
+    return samplePool->getOrLoad (file, targetRate, quality, resident,
+                                  [&] { return readSample (file, targetRate, quality, resident); });
+}
+
+SampleData::Ptr SampleEngine::findLoadedSample (const juce::File& file)
+{
+    const double targetRate = currentSampleRate.load();
+    const auto quality = resampleQuality.load();
+
+    if (auto held = samplePool->find (file, targetRate, quality, true))
+        return held;
+
+    return samplePool->find (file, targetRate, quality, false);
+}
+
+juce::int64 SampleEngine::estimateSampleSize (const juce::File& file)
+{
+    if (auto loaded = findLoadedSample (file))
+        return (juce::int64) loaded->buffer.getNumChannels() * loaded->buffer.getNumSamples() * (juce::int64) sizeof (float);
 
     std::unique_ptr<juce::AudioFormatReader> reader (formatManager.createReaderFor (file));
-    if (reader == nullptr)
-        return;
+    if (reader == nullptr || reader->sampleRate <= 0)
+        return 0;
 
-    juce::AudioBuffer<float> newBuffer ((int) reader->numChannels, (int) reader->lengthInSamples);
-    reader->read (&newBuffer, 0, (int) reader->lengthInSamples, 0, true, true);
+    auto length = (double) reader->lengthInSamples;
+    const double targetRate = currentSampleRate.load();
+    if (targetRate > 0)
+        length *= targetRate / reader->sampleRate;
 
-    // Resample if needed
-    if (reader->sampleRate != currentSampleRate && currentSampleRate > 0)
-    {
-        double ratio = currentSampleRate / reader->sampleRate;
-        int newLength = (int) (newBuffer.getNumSamples() * ratio);
-        juce::AudioBuffer<float> resampled (newBuffer.getNumChannels(), newLength);
+    return (juce::int64) reader->numChannels * (juce::int64) std::ceil (length) * (juce::int64) sizeof (float);
+}
+
+SampleData::Ptr SampleEngine::readSample (const juce::File& file, double targetRate,
+                                          Resampler::Quality quality, bool resident)
+{
+    const auto cacheKey = SampleCache::makeKey (file, targetRate, quality);
 
-        for (int ch = 0; ch < newBuffer.getNumChannels(); ++ch)
+    SampleData::Ptr data = new SampleData();
+    data->name = file.getFileNameWithoutExtension();
+    data->file = file;
+    data->resident = resident;
+
+    // Play straight from the mapped cache entry when there is one, unless
+    // the sample has to stay in RAM
+    if (cacheKey.has_value())
+    {
+        if (auto cached = sampleCache.read (*cacheKey))
         {
-            auto* src = newBuffer.getReadPointer (ch);
-            auto* dst = resampled.getWritePointer (ch);
-            for (int i = 0; i < newLength; ++i)
+            if (resident)
             {
-                double srcPos = i / ratio;
-                int idx = (int) srcPos;
-                float frac = (float) (srcPos - idx);
-                if (idx + 1 < newBuffer.getNumSamples())
-                    dst[i] = src[idx] * (1.0f - frac) + src[idx + 1] * frac;
-                else if (idx < newBuffer.getNumSamples())
-                    dst[i] = src[idx];
-                else
-                    dst[i] = 0.0f;
+                data->buffer.makeCopyOf (cached->buffer);
+            }
+            else
+            {
+                data->mappedFile = std::move (cached->mapping);
+                data->buffer = std::move (cached->buffer);
             }
+
+            data->sampleRate = cached->sampleRate;
+            data->mixers = MixKernels::rowForSource (data->buffer.getNumChannels());
+            return data;
         }
-        newBuffer = std::move (resampled);
     }
 
+    std::unique_ptr<juce::AudioFormatReader> reader (formatManager.createReaderFor (file));
+    if (reader == nullptr)
+        return nullptr;
+
+    juce::AudioBuffer<float> newBuffer ((int) reader->numChannels, (int) reader->lengthInSamples);
+    reader->read (&newBuffer, 0, (int) reader->lengthInSamples, 0, true, true);
+
+    double bufferRate = reader->sampleRate;
+    if (bufferRate != targetRate && targetRate > 0)
+    {
+        newBuffer = Resampler::process (newBuffer, bufferRate, targetRate, quality);
+        bufferRate = targetRate;
+    }
+
+    if (cacheKey.has_value())
+        sampleCache.write (*cacheKey, newBuffer, bufferRate);
+
+    data->buffer = std::move (newBuffer);
+    data->sampleRate = bufferRate;
+    data->mixers = MixKernels::rowForSource (data->buffer.getNumChannels());
+    return data;
+}
+
+SampleEngine::KitBank::Ptr SampleEngine::copyActiveBank() const
+{
+    KitBank::Ptr bank = new KitBank();
+    bank->pads = activeBankOwner->pads;
+    return bank;
+}
+
+bool SampleEngine::publishBank (KitBank::Ptr bank)
+{
+    bool needsConversion = false;
+    const double sampleRate = currentSampleRate.load();
+
+    for (size_t i = 0; i < bank->pads.size(); ++i)
+    {
+        // Samples leaving the kit may still be sounding; the release pool
+        // takes a reference too, so a voice never drops the last one
+        auto& previous = activeBankOwner->pads[i].sample;
+        if (previous != nullptr && previous != bank->pads[i].sample)
+            retire (previous);
+
+        // Decoded before a rate change that the running re-conversion pass
+        // has already gone past
+        auto& sample = bank->pads[i].sample;
+        if (sample != nullptr && sample->sampleRate != sampleRate)
+            needsConversion = true;
+    }
+
+    activeBank.store (bank.get());
+    ++bankSerial;
+    releasePool->retire (std::move (activeBankOwner));
+    activeBankOwner = std::move (bank);
+
+    return needsConversion;
+}
+
+void SampleEngine::updatePad (int midiNote, SampleData::Ptr data, const juce::String& missingName)
+{
+    bool needsConversion = false;
+
     {
         std::lock_guard<std::mutex> lock (loadMutex);
-        auto& slot = slots[(size_t) midiNote];
+        auto bank = copyActiveBank();
+        bank->pads[(size_t) midiNote] = { std::move (data), missingName };
+        needsConversion = publishBank (std::move (bank));
+    }
 
-        for (auto& voice : slot.voices)
-            voice.active.store (false);
+    if (needsConversion)
+        requestReconversion();
+}
+
+void SampleEngine::beginKit()
+{
+    std::lock_guard<std::mutex> lock (loadMutex);
+    stagingBank = copyActiveBank();
+
+    for (size_t i = 0; i < slots.size(); ++i)
+        stagedVolumes[i] = padVolumes[i];
+}
+
+void SampleEngine::stagePad (int midiNote, SampleData::Ptr data, const juce::String& missingName)
+{
+    if (midiNote < 0 || midiNote >= kTotalSlots)
+        return;
+
+    std::lock_guard<std::mutex> lock (loadMutex);
+    if (stagingBank != nullptr)
+        stagingBank->pads[(size_t) midiNote] = { std::move (data), missingName };
+}
+
+void SampleEngine::stageVolume (int midiNote, float volume)
+{
+    if (midiNote < 0 || midiNote >= kTotalSlots)
+        return;
+
+    std::lock_guard<std::mutex> lock (loadMutex);
+    stagedVolumes[(size_t) midiNote] = juce::jlimit (0.0f, 2.0f, volume);
+}
+
+void SampleEngine::commitKit()
+{
+    bool needsConversion = false;
+
+    {
+        std::lock_guard<std::mutex> lock (loadMutex);
+        if (stagingBank == nullptr)
+            return;
+
+        for (size_t i = 0; i < slots.size(); ++i)
+            postVolume ((int) i, stagedVolumes[i]);
+
+        needsConversion = publishBank (std::move (stagingBank));
+        stagingBank = nullptr;
+    }
+
+    if (needsConversion)
+        requestReconversion();
+}
+
+void SampleEngine::setKitFadeTime (float milliseconds)
+{
+    kitFadeMs.store (juce::jlimit (0.0f, 500.0f, milliseconds));
+}
+
+float SampleEngine::getKitFadeTime() const
+{
+    return kitFadeMs.load();
+}
+
+void SampleEngine::replaceSample (int midiNote, const SampleData* expected, SampleData::Ptr replacement)
+{
+    std::lock_guard<std::mutex> lock (loadMutex);
+
+    // A kit being staged from the old data gets the new copy as well
+    if (stagingBank != nullptr && stagingBank->pads[(size_t) midiNote].sample.get() == expected)
+        stagingBank->pads[(size_t) midiNote].sample = replacement;
+
+    // The pad was reassigned while its replacement was being made
+    if (activeBankOwner->pads[(size_t) midiNote].sample.get() != expected)
+        return;
+
+    // Same file, so sounding voices carry on with the old data
+    auto bank = copyActiveBank();
+    bank->pads[(size_t) midiNote].sample = std::move (replacement);
+    publishBank (std::move (bank));
+}
+
+void SampleEngine::retire (SampleData::Ptr data)
+{
+    // A pooled sample stays referenced by the SamplePool, which drops it
+    // itself once the release pool has let go
+    if (data != nullptr)
+    {
+        int sharedOwners = data->pooled ? 1 : 0;
+        releasePool->retire (std::move (data), sharedOwners);
+    }
+}
+
+void SampleEngine::requestReconversion()
+{
+    ++reconversionRequests;
+    backgroundThread.moveToFrontOfQueue (this);
+}
+
+SampleData::Ptr SampleEngine::convertToCurrentRate (const SampleData& data)
+{
+    // Going back to the file avoids stacking one conversion on another
+    if (auto decoded = decodeSample (data.file, data.resident))
+        return decoded;
+
+    const double targetRate = currentSampleRate.load();
+
+    SampleData::Ptr converted = new SampleData();
+    converted->buffer = Resampler::process (data.buffer, data.sampleRate, targetRate, resampleQuality.load());
+    converted->name = data.name;
+    converted->file = data.file;
+    converted->sampleRate = targetRate;
+    converted->mixers = data.mixers;
+    converted->resident = data.resident;
+    return converted;
+}
+
+int SampleEngine::useTimeSlice()
+{
+    // A new request restarts the pass, since the target rate may have moved
+    auto requests = reconversionRequests.load();
+    if (requests != reconversionsHandled)
+    {
+        reconversionsHandled = requests;
+        nextSlotToConvert = 0;
+    }
+
+    const double sampleRate = currentSampleRate.load();
+
+    for (; nextSlotToConvert < kTotalSlots; ++nextSlotToConvert)
+    {
+        SampleData::Ptr current;
+        {
+            std::lock_guard<std::mutex> lock (loadMutex);
+            current = activeBankOwner->pads[(size_t) nextSlotToConvert].sample;
+        }
+
+        if (current == nullptr || current->sampleRate == sampleRate)
+            continue;
 
-        slot.buffer = std::move (newBuffer);
-        slot.sampleName = file.getFileNameWithoutExtension();
-        slot.sampleFile = file;
-        slot.loaded = true;
-        slot.missing = false;
+        if (auto converted = convertToCurrentRate (*current))
+            replaceSample (nextSlotToConvert, current.get(), std::move (converted));
+
+        ++nextSlotToConvert;
+        return 0;
     }
+
+    return 500;
+}
+
+void SampleEngine::loadSample (int midiNote, const juce::File& file)
+{
+    if (midiNote < 0 || midiNote >= kTotalSlots)
+        return;
+
+    if (auto data = decodeSample (file))
+        updatePad (midiNote, std::move (data), {});
+}
+
+void SampleEngine::setSample (int midiNote, SampleData::Ptr data)
+{
+    if (midiNote < 0 || midiNote >= kTotalSlots || data == nullptr)
+        return;
+
+    updatePad (midiNote, std::move (data), {});
 }
 
 void SampleEngine::clearSample (int midiNote)
@@ -76,16 +397,10 @@ void SampleEngine::clearSample (int midiNote)
     if (midiNote < 0 || midiNote >= kTotalSlots)
         return;
 
+    updatePad (midiNote, nullptr, {});
+
     std::lock_guard<std::mutex> lock (loadMutex);
-    auto& slot = slots[(size_t) midiNote];
-    for (auto& voice : slot.voices)
-        voice.active.store (false);
-    slot.buffer.setSize (0, 0);
-    slot.sampleName.clear();
-    slot.sampleFile = juce::File();
-    slot.loaded = false;
-    slot.missing = false;
-    slot.volume = 1.0f;
+    postVolume (midiNote, 1.0f);
 }
 
 void SampleEngine::swapSamples (int noteA, int noteB)
@@ -95,126 +410,367 @@ void SampleEngine::swapSamples (int noteA, int noteB)
 
     std::lock_guard<std::mutex> lock (loadMutex);
 
-    auto& slotA = slots[(size_t) noteA];
-    auto& slotB = slots[(size_t) noteB];
-
-    for (auto& v : slotA.voices)
-        v.active.store (false);
-    for (auto& v : slotB.voices)
-        v.active.store (false);
+    auto bank = copyActiveBank();
+    std::swap (bank->pads[(size_t) noteA], bank->pads[(size_t) noteB]);
+    publishBank (std::move (bank));
 
-    std::swap (slotA.buffer, slotB.buffer);
-    std::swap (slotA.sampleName, slotB.sampleName);
-    std::swap (slotA.sampleFile, slotB.sampleFile);
-    std::swap (slotA.loaded, slotB.loaded);
-    std::swap (slotA.missing, slotB.missing);
-    std::swap (slotA.volume, slotB.volume);
+    float volumeA = padVolumes[(size_t) noteA];
+    postVolume (noteA, padVolumes[(size_t) noteB]);
+    postVolume (noteB, volumeA);
 }
 
 bool SampleEngine::hasSample (int midiNote) const
 {
     if (midiNote < 0 || midiNote >= kTotalSlots)
         return false;
-    return slots[(size_t) midiNote].loaded;
+
+    std::lock_guard<std::mutex> lock (loadMutex);
+    return activeBankOwner->pads[(size_t) midiNote].sample != nullptr;
 }
 
 juce::String SampleEngine::getSampleName (int midiNote) const
 {
     if (midiNote < 0 || midiNote >= kTotalSlots)
         return {};
-    return slots[(size_t) midiNote].sampleName;
+
+    std::lock_guard<std::mutex> lock (loadMutex);
+    auto& pad = activeBankOwner->pads[(size_t) midiNote];
+    return pad.sample != nullptr ? pad.sample->name : pad.missingName;
 }
 
 juce::File SampleEngine::getSampleFile (int midiNote) const
 {
     if (midiNote < 0 || midiNote >= kTotalSlots)
         return {};
-    return slots[(size_t) midiNote].sampleFile;
+
+    std::lock_guard<std::mutex> lock (loadMutex);
+    auto& pad = activeBankOwner->pads[(size_t) midiNote];
+    return pad.sample != nullptr ? pad.sample->file : juce::File();
 }
 
 void SampleEngine::setPadVolume (int midiNote, float volume)
 {
     if (midiNote < 0 || midiNote >= kTotalSlots)
         return;
-    slots[(size_t) midiNote].volume = juce::jlimit (0.0f, 2.0f, volume);
+
+    std::lock_guard<std::mutex> lock (loadMutex);
+    postVolume (midiNote, juce::jlimit (0.0f, 2.0f, volume));
 }
 
 float SampleEngine::getPadVolume (int midiNote) const
 {
     if (midiNote < 0 || midiNote >= kTotalSlots)
         return 1.0f;
-    return slots[(size_t) midiNote].volume;
+
+    std::lock_guard<std::mutex> lock (loadMutex);
+    return padVolumes[(size_t) midiNote];
+}
+
+//==============================================================================
+bool SampleEngine::postCommand (Command command)
+{
+    std::lock_guard<std::mutex> lock (commandWriteMutex);
+
+    const auto scope = commandFifo.write (1);
+    if (scope.blockSize1 + scope.blockSize2 == 0)
+        return false;
+
+    commands[(size_t) (scope.blockSize1 > 0 ? scope.startIndex1 : scope.startIndex2)] = command;
+    return true;
+}
+
+void SampleEngine::postVolume (int midiNote, float volume)
+{
+    auto& current = padVolumes[(size_t) midiNote];
+    if (current == volume)
+        return;
+
+    current = volume;
+
+    if (! postCommand ({ Command::Type::setVolume, midiNote, volume }))
+        volumesNeedResync.store (true);
+}
+
+void SampleEngine::playPad (int midiNote, float velocity)
+{
+    if (midiNote >= 0 && midiNote < kTotalSlots)
+        postCommand ({ Command::Type::noteOn, midiNote, velocity });
+}
+
+void SampleEngine::applyPendingCommands() noexcept
+{
+    {
+        const auto scope = commandFifo.read (commandFifo.getNumReady());
+
+        for (int i = 0; i < scope.blockSize1; ++i)
+            applyCommand (commands[(size_t) (scope.startIndex1 + i)]);
+
+        for (int i = 0; i < scope.blockSize2; ++i)
+            applyCommand (commands[(size_t) (scope.startIndex2 + i)]);
+    }
+
+    if (volumesNeedResync.load())
+    {
+        std::unique_lock<std::mutex> lock (loadMutex, std::try_to_lock);
+        if (lock.owns_lock())
+        {
+            volumesNeedResync.store (false);
+            for (size_t i = 0; i < slots.size(); ++i)
+                slots[i].volume = padVolumes[i];
+        }
+    }
+}
+
+void SampleEngine::applyCommand (const Command& command) noexcept
+{
+    switch (command.type)
+    {
+        case Command::Type::noteOn:     noteOn (command.midiNote, command.value); break;
+        case Command::Type::stopVoices: stopVoices (command.midiNote); break;
+        case Command::Type::setVolume:  slots[(size_t) command.midiNote].volume = command.value; break;
+    }
 }
 
-void SampleEngine::noteOn (int midiNote, float velocity)
+void SampleEngine::noteOn (int midiNote, float velocity, int sampleOffset)
 {
     if (midiNote < 0 || midiNote >= kTotalSlots)
         return;
 
     auto& slot = slots[(size_t) midiNote];
-    if (! slot.loaded)
+
+    SampleData::Ptr sample;
+    {
+        ReleasePool::ScopedAcquire acquire (*releasePool);
+        sample = activeBank.load()->pads[(size_t) midiNote].sample;
+    }
+
+    if (sample == nullptr)
         return;
 
-    for (auto& voice : slot.voices)
+    auto busy = slot.activeVoices.load();
+
+    // Steal oldest voice (voice 0) if every voice is busy
+    int index = 0;
+    for (int i = 0; i < kMaxVoicesPerPad; ++i)
     {
-        if (! voice.active.load())
+        if ((busy & (1u << i)) == 0)
         {
-            voice.position = 0;
-            voice.velocity = velocity;
-            voice.active.store (true);
-            return;
+            index = i;
+            break;
         }
     }
 
-    // Steal oldest voice (voice 0)
-    slot.voices[0].position = 0;
-    slot.voices[0].velocity = velocity;
-    slot.voices[0].active.store (true);
+    auto& voice = slot.voices[(size_t) index];
+    slot.stoppedVoices.fetch_and (~(1u << index));
+    voice.sample = std::move (sample);
+    voice.position = 0;
+    voice.fraction = 0.0;
+    voice.startOffset = juce::jmax (0, sampleOffset);
+    voice.velocity = velocity;
+    voice.gain = velocity * slot.volume;
+    voice.releaseStep = 0.0f;
+    slot.activeVoices.fetch_or (1u << index);
+
+    markSlotActive (midiNote);
+}
+
+bool SampleEngine::isSilent() const noexcept
+{
+    for (auto& word : activeSlots)
+        if (word.load() != 0)
+            return false;
+    return ! preview.isActive();
+}
+
+void SampleEngine::markSlotActive (int midiNote) noexcept
+{
+    activeSlots[(size_t) (midiNote / 64)].fetch_or ((juce::uint64) 1 << (midiNote % 64));
+}
+
+void SampleEngine::stopVoices (int midiNote) noexcept
+{
+    // The render pass drops the stopped voices' sample references and then
+    // clears the slot's bit in activeSlots
+    auto& slot = slots[(size_t) midiNote];
+    auto stopped = slot.activeVoices.exchange (0);
+
+    if (stopped != 0)
+    {
+        slot.stoppedVoices.fetch_or (stopped);
+        markSlotActive (midiNote);
+    }
+}
+
+void SampleEngine::fadeReplacedVoices (const KitBank& bank) noexcept
+{
+    const float fadeSamples = juce::jmax (1.0f, kitFadeMs.load() * 0.001f * (float) currentSampleRate.load());
+
+    for (size_t word = 0; word < activeSlots.size(); ++word)
+    {
+        for (auto slotBits = activeSlots[word].load(); slotBits != 0; slotBits &= slotBits - 1)
+        {
+            auto index = word * 64 + (size_t) std::countr_zero (slotBits);
+            auto& slot = slots[index];
+            auto* current = bank.pads[index].sample.get();
+
+            for (auto voiceBits = slot.activeVoices.load(); voiceBits != 0; voiceBits &= voiceBits - 1)
+            {
+                auto& voice = slot.voices[(size_t) std::countr_zero (voiceBits)];
+
+                // A re-converted copy of the same file doesn't count as a change
+                if (voice.releaseStep > 0.0f || voice.sample.get() == current
+                    || (current != nullptr && voice.sample->file == current->file))
+                    continue;
+
+                voice.releaseStep = juce::jmax (voice.gain, 1.0e-6f) / fadeSamples;
+            }
+        }
+    }
 }
 
 void SampleEngine::renderNextBlock (juce::AudioBuffer<float>& outputBuffer, int startSample, int numSamples)
 {
-    for (auto& slot : slots)
+    int outChannels = juce::jmin (outputBuffer.getNumChannels(), 2);
+    if (outChannels == 0)
+        return;
+
+    float* const dst[2] = { outputBuffer.getWritePointer (0, startSample),
+                            outputBuffer.getWritePointer (outChannels - 1, startSample) };
+    const double playbackRate = currentSampleRate.load();
+
+    // A new bank was published since the last block
+    auto serial = bankSerial.load();
+    if (serial != renderedBankSerial)
     {
-        if (! slot.loaded)
-            continue;
+        renderedBankSerial = serial;
 
-        for (auto& voice : slot.voices)
+        ReleasePool::ScopedAcquire acquire (*releasePool);
+        fadeReplacedVoices (*activeBank.load());
+    }
+
+    for (size_t word = 0; word < activeSlots.size(); ++word)
+    {
+        auto slotBits = activeSlots[word].load();
+
+        while (slotBits != 0)
         {
-            if (! voice.active.load())
-                continue;
+            auto bit = std::countr_zero (slotBits);
+            slotBits &= slotBits - 1;
 
-            int samplesAvailable = slot.buffer.getNumSamples() - voice.position;
-            int samplesToRender = juce::jmin (numSamples, samplesAvailable);
+            auto& slot = slots[word * 64 + (size_t) bit];
+            auto voiceBits = slot.activeVoices.load();
+            juce::uint32 finished = 0;
 
-            if (samplesToRender <= 0)
+            float volume = slot.volume;
+
+            for (auto pending = voiceBits; pending != 0; pending &= pending - 1)
             {
-                voice.active.store (false);
-                continue;
+                auto voiceIndex = std::countr_zero (pending);
+                auto& voice = slot.voices[(size_t) voiceIndex];
+                auto& buffer = voice.sample->buffer;
+
+                int offset = voice.startOffset;
+                if (offset >= numSamples)
+                {
+                    voice.startOffset -= numSamples;
+                    continue;
+                }
+                voice.startOffset = 0;
+
+                int lastSrcChannel = juce::jmin (buffer.getNumChannels(), 2) - 1;
+                int samplesAvailable = buffer.getNumSamples() - voice.position;
+                int outputSamples = numSamples - offset;
+
+                // Ramp towards the current pad volume so slider moves don't
+                // zipper, or down to silence for a voice being faded out
+                float targetGain = voice.velocity * volume;
+                if (voice.releaseStep > 0.0f)
+                {
+                    outputSamples = juce::jmin (outputSamples, (int) std::ceil (voice.gain / voice.releaseStep));
+                    targetGain = juce::jmax (0.0f, voice.gain - voice.releaseStep * (float) outputSamples);
+                }
+
+                int samplesToRender = juce::jmin (outputSamples, samplesAvailable);
+
+                if (samplesToRender <= 0 || lastSrcChannel < 0)
+                {
+                    finished |= 1u << voiceIndex;
+                    continue;
+                }
+
+                float* const voiceDst[2] = { dst[0] + offset, dst[1] + offset };
+
+                if (voice.sample->sampleRate == playbackRate)
+                {
+                    const float* const src[2] = { buffer.getReadPointer (0, voice.position),
+                                                  buffer.getReadPointer (lastSrcChannel, voice.position) };
+
+                    auto mix = voice.sample->mixers[(size_t) outChannels - 1];
+                    mix (voiceDst, src, samplesToRender, voice.gain, targetGain);
+                    voice.position += samplesToRender;
+                }
+                else
+                {
+                    const float* const src[2] = { buffer.getReadPointer (0),
+                                                  buffer.getReadPointer (lastSrcChannel) };
+
+                    mixInterpolated (voiceDst, outChannels, src, buffer.getNumSamples(),
+                                     voice.position, voice.fraction, voice.sample->sampleRate / playbackRate,
+                                     outputSamples, voice.gain, targetGain);
+                }
+
+                voice.gain = targetGain;
+
+                if (voice.position >= buffer.getNumSamples() || (voice.releaseStep > 0.0f && targetGain <= 0.0f))
+                    finished |= 1u << voiceIndex;
             }
 
-            float gain = voice.velocity * slot.volume;
-            int outChannels = outputBuffer.getNumChannels();
-            int srcChannels = slot.buffer.getNumChannels();
+            auto remaining = finished != 0 ? slot.activeVoices.fetch_and (~finished) & ~finished
+                                           : voiceBits;
+
+            // Drop sample references of finished and externally stopped voices.
+            // The release pool holds the last reference, so this never frees.
+            auto idle = (finished | slot.stoppedVoices.exchange (0)) & ~slot.activeVoices.load();
+            for (; idle != 0; idle &= idle - 1)
+                slot.voices[(size_t) std::countr_zero (idle)].sample = nullptr;
 
-            for (int ch = 0; ch < outChannels; ++ch)
+            if (remaining == 0)
             {
-                int srcCh = juce::jmin (ch, srcChannels - 1);
-                outputBuffer.addFrom (ch, startSample, slot.buffer,
-                                      srcCh, voice.position, samplesToRender, gain);
-            }
+                auto slotBit = (juce::uint64) 1 << bit;
+                activeSlots[word].fetch_and (~slotBit);
 
-            voice.position += samplesToRender;
-            if (voice.position >= slot.buffer.getNumSamples())
-                voice.active.store (false);
+                // A noteOn may have landed between the two updates above
+                if (slot.activeVoices.load() != 0)
+                    activeSlots[word].fetch_or (slotBit);
+            }
         }
     }
+
+    preview.renderNextBlock (outputBuffer, startSample, numSamples);
 }
 
 void SampleEngine::clearAllSamples()
 {
+    std::lock_guard<std::mutex> lock (loadMutex);
+
     for (int i = 0; i < kTotalSlots; ++i)
-        clearSample (i);
+        postVolume (i, 1.0f);
+
+    publishBank (new KitBank());
+}
+
+void SampleEngine::setResampleQuality (Resampler::Quality quality)
+{
+    if (resampleQuality.exchange (quality) != quality)
+    {
+        auto sampleRate = currentSampleRate.load();
+        juce::Thread::launch ([sampleRate, quality] { Resampler::warmUp (sampleRate, quality); });
+    }
+}
+
+Resampler::Quality SampleEngine::getResampleQuality() const
+{
+    return resampleQuality.load();
 }
 
 void SampleEngine::markSampleMissing (int midiNote, const juce::String& name)
@@ -222,34 +778,25 @@ void SampleEngine::markSampleMissing (int midiNote, const juce::String& name)
     if (midiNote < 0 || midiNote >= kTotalSlots)
         return;
 
-    std::lock_guard<std::mutex> lock (loadMutex);
-    auto& slot = slots[(size_t) midiNote];
-    for (auto& voice : slot.voices)
-        voice.active.store (false);
-    slot.buffer.setSize (0, 0);
-    slot.sampleName = name;
-    slot.sampleFile = juce::File();
-    slot.loaded = false;
-    slot.missing = true;
+    updatePad (midiNote, nullptr, name);
 }
 
 bool SampleEngine::isSampleMissing (int midiNote) const
 {
     if (midiNote < 0 || midiNote >= kTotalSlots)
         return false;
-    return slots[(size_t) midiNote].missing;
+
+    std::lock_guard<std::mutex> lock (loadMutex);
+    auto& pad = activeBankOwner->pads[(size_t) midiNote];
+    return pad.sample == nullptr && pad.missingName.isNotEmpty();
 }
 
 void SampleEngine::previewSample (const juce::File& file)
 {
-    stopPreview();
-    loadSample (kPreviewSlot, file);
-    noteOn (kPreviewSlot, 0.8f);
+    preview.play (file, 0.8f);
 }
 
 void SampleEngine::stopPreview()
 {
-    auto& slot = slots[(size_t) kPreviewSlot];
-    for (auto& voice : slot.voices)
-        voice.active.store (false);
+    preview.stop();
 }
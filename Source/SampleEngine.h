@@ -1,65 +1,214 @@
 #pragma once
 #include <juce_audio_basics/juce_audio_basics.h>
 #include <juce_audio_formats/juce_audio_formats.h>
+#include "PreviewVoice.h"
+#include "ReleasePool.h"
+#include "Resampler.h"
+#include "SampleCache.h"
+#include "SampleData.h"
+#include "SamplePool.h"
 #include <array>
 #include <atomic>
 #include <mutex>
 
-class SampleEngine
+class SampleEngine : private juce::TimeSliceClient
 {
 public:
     SampleEngine();
+    ~SampleEngine() override;
 
+    // A rate change re-converts the loaded samples in the background; pads
+    // keep playing at the right pitch from their old data until then.
     void prepareToPlay (double sampleRate, int samplesPerBlock);
     void releaseResources();
 
+    double getSampleRate() const { return currentSampleRate.load(); }
+
     void loadSample (int midiNote, const juce::File& file);
+
+    // Thread-safe halves of loadSample, so decoding can run on worker threads
+    // and the result be published separately. Files already loaded at the
+    // current rate come back from the shared SamplePool without decoding.
+    // A resident sample is copied out of the cache rather than mapped, so
+    // the audio thread never faults on it; other loads use the resident
+    // copy of a file when there is one.
+    SampleData::Ptr decodeSample (const juce::File& file, bool resident = false);
+
+    // The file's sample if it is already loaded at the current rate, else nullptr.
+    SampleData::Ptr findLoadedSample (const juce::File& file);
+
+    // Memory the file's sample takes, or would take once decoded at the
+    // current rate, worked out from its header without decoding it.
+    juce::int64 estimateSampleSize (const juce::File& file);
+    void setSample (int midiNote, SampleData::Ptr data);
     void clearSample (int midiNote);
     void swapSamples (int noteA, int noteB);
     bool hasSample (int midiNote) const;
     juce::String getSampleName (int midiNote) const;
     juce::File getSampleFile (int midiNote) const;
 
-    void noteOn (int midiNote, float velocity);
+    // Volume changes, UI-triggered notes and preview stops from other threads
+    // are queued and applied here, so the audio thread is the only writer of
+    // voice and volume state. Call at the start of every block, before noteOn.
+    void applyPendingCommands() noexcept;
+
+    // Audio thread only. sampleOffset delays the start of the voice by that
+    // many samples into the next rendered block, so hits land where the host
+    // timestamped them.
+    void noteOn (int midiNote, float velocity, int sampleOffset = 0);
+
+    // Plays a pad from any other thread, e.g. when it is clicked.
+    void playPad (int midiNote, float velocity);
     void renderNextBlock (juce::AudioBuffer<float>& outputBuffer, int startSample, int numSamples);
 
+    // True when no voice is sounding, so the caller can skip rendering entirely.
+    bool isSilent() const noexcept;
+
     void clearAllSamples();
 
+    // Kit switching. beginKit() starts a staging bank as a copy of the active
+    // one, stagePad() and stageVolume() fill it in off the audio thread, and
+    // commitKit() makes the whole kit active at once, at the next block.
+    // Voices of pads whose file changed fade out over the kit fade time
+    // rather than being cut. Single-pad edits switch banks the same way.
+    void beginKit();
+    void stagePad (int midiNote, SampleData::Ptr data, const juce::String& missingName = {});
+    void stageVolume (int midiNote, float volume);
+    void commitKit();
+
+    void setKitFadeTime (float milliseconds);
+    float getKitFadeTime() const;
+
+    // Quality used when a sample's rate differs from the playback rate.
+    // Applies to samples decoded after the change.
+    void setResampleQuality (Resampler::Quality quality);
+    Resampler::Quality getResampleQuality() const;
+
     void setPadVolume (int midiNote, float volume);
     float getPadVolume (int midiNote) const;
 
     void markSampleMissing (int midiNote, const juce::String& name);
     bool isSampleMissing (int midiNote) const;
 
+    // Previews play on their own voice, streamed from disk, so they never
+    // touch the pads or the sample pool.
     void previewSample (const juce::File& file);
     void stopPreview();
 
-    static constexpr int kPreviewSlot = 0;
-
 private:
     static constexpr int kMaxVoicesPerPad = 8;
     static constexpr int kTotalSlots = 128;
+    static constexpr int kSlotMaskWords = kTotalSlots / 64;
 
     struct Voice
     {
-        std::atomic<bool> active { false };
+        SampleData::Ptr sample;
         int position = 0;
+        double fraction = 0.0;  // sub-sample position, only used while rates differ
+        int startOffset = 0;    // samples to skip in the next block before playing
         float velocity = 1.0f;
+        float gain = 0.0f;      // gain reached at the end of the last rendered block
+        float releaseStep = 0.0f;   // gain drop per sample once fading out, else 0
+    };
+
+    // The samples of a whole kit. Immutable once published; every change
+    // publishes a new bank.
+    struct KitBank : public juce::ReferenceCountedObject
+    {
+        using Ptr = juce::ReferenceCountedObjectPtr<KitBank>;
+
+        struct Pad
+        {
+            SampleData::Ptr sample;
+            juce::String missingName;   // shown when sample is null
+        };
+
+        std::array<Pad, kTotalSlots> pads;
     };
 
     struct SampleSlot
     {
-        juce::AudioBuffer<float> buffer;
-        juce::String sampleName;
-        juce::File sampleFile;
-        bool loaded = false;
-        bool missing = false;
-        float volume = 1.0f;
+        float volume = 1.0f;    // audio thread only; see padVolumes
+
         std::array<Voice, kMaxVoicesPerPad> voices;
+        std::atomic<juce::uint32> activeVoices { 0 };   // one bit per entry in voices
+        std::atomic<juce::uint32> stoppedVoices { 0 };  // stopped voices still holding a sample
     };
 
     std::array<SampleSlot, kTotalSlots> slots;
+
+    // What the audio thread plays. Written only while holding loadMutex,
+    // always together with activeBankOwner, which keeps the bank alive.
+    // bankSerial lets the render pass notice a switch without dereferencing.
+    std::atomic<KitBank*> activeBank { nullptr };
+    KitBank::Ptr activeBankOwner;
+    std::atomic<juce::uint32> bankSerial { 0 };
+    juce::uint32 renderedBankSerial = 0;    // audio thread only
+
+    // Being assembled by beginKit/stagePad; guarded by loadMutex
+    KitBank::Ptr stagingBank;
+    std::array<float, kTotalSlots> stagedVolumes;
+
+    std::atomic<float> kitFadeMs { 10.0f };
+
+    // Commands from other threads for the audio thread. Producers serialise
+    // on commandWriteMutex; the audio thread reads without locking.
+    struct Command
+    {
+        enum class Type : juce::uint8 { noteOn, stopVoices, setVolume };
+
+        Type type = Type::noteOn;
+        int midiNote = 0;
+        float value = 0.0f;     // velocity or volume
+    };
+
+    static constexpr int kCommandCapacity = 1024;
+    juce::AbstractFifo commandFifo { kCommandCapacity };
+    std::array<Command, kCommandCapacity> commands;
+    std::mutex commandWriteMutex;
+
+    // The volumes as last set, guarded by loadMutex. If a volume command
+    // can't be queued, e.g. while the host isn't processing, the audio
+    // thread copies these over once it can take the lock without waiting.
+    std::array<float, kTotalSlots> padVolumes;
+    std::atomic<bool> volumesNeedResync { false };
+
+    // One bit per slot with at least one sounding voice. noteOn sets bits, the
+    // render loop clears them as voices retire, so a block only visits slots
+    // that are actually playing.
+    std::array<std::atomic<juce::uint64>, kSlotMaskWords> activeSlots {};
+
     juce::AudioFormatManager formatManager;
-    double currentSampleRate = 44100.0;
-    std::mutex loadMutex;
+    PreviewVoice preview { formatManager };
+    SampleCache sampleCache;
+    std::atomic<double> currentSampleRate { 44100.0 };
+    std::atomic<Resampler::Quality> resampleQuality { Resampler::Quality::standard };
+    mutable std::mutex loadMutex;
+    juce::SharedResourcePointer<ReleasePool> releasePool;
+    juce::SharedResourcePointer<SamplePool> samplePool;
+
+    // Re-conversion after a sample-rate change, one pad per time slice
+    juce::TimeSliceThread backgroundThread { "Beatwerk sample engine" };
+    std::atomic<int> reconversionRequests { 0 };
+    int reconversionsHandled = 0;
+    int nextSlotToConvert = kTotalSlots;
+
+    int useTimeSlice() override;
+    void requestReconversion();
+    SampleData::Ptr readSample (const juce::File& file, double targetRate, Resampler::Quality quality, bool resident);
+    SampleData::Ptr convertToCurrentRate (const SampleData& data);
+    void retire (SampleData::Ptr data);
+    void replaceSample (int midiNote, const SampleData* expected, SampleData::Ptr replacement);
+
+    KitBank::Ptr copyActiveBank() const;
+    bool publishBank (KitBank::Ptr bank);    // true if it holds samples at another rate
+    void updatePad (int midiNote, SampleData::Ptr data, const juce::String& missingName);
+
+    bool postCommand (Command command);
+    void postVolume (int midiNote, float volume);   // caller holds loadMutex
+    void applyCommand (const Command& command) noexcept;
+
+    void markSlotActive (int midiNote) noexcept;
+    void stopVoices (int midiNote) noexcept;
+    void fadeReplacedVoices (const KitBank& bank) noexcept;
 };
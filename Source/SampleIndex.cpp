@@ -0,0 +1,342 @@
+#include "SampleIndex.h"
+#include <string_view>
+#include <utility>
+
+namespace
+{
+    juce::uint32 trigramAt (const std::string& s, size_t i)
+    {
+        return (juce::uint32) (juce::uint8) s[i]
+             | (juce::uint32) (juce::uint8) s[i + 1] << 8
+             | (juce::uint32) (juce::uint8) s[i + 2] << 16;
+    }
+
+    std::string toLowerPath (const juce::String& path)
+    {
+        return path.toLowerCase().replaceCharacter ('\\', '/').toStdString();
+    }
+}
+
+SampleIndex::SampleIndex()
+    : juce::Thread ("Beatwerk sample index")
+{
+    startThread (juce::Thread::Priority::low);
+}
+
+SampleIndex::~SampleIndex()
+{
+    ++searchGeneration;
+    stopThread (5000);
+}
+
+bool SampleIndex::isAudioFile (const juce::File& f)
+{
+    auto ext = f.getFileExtension().toLowerCase();
+    return ext == ".wav" || ext == ".aif" || ext == ".aiff" || ext == ".flac" || ext == ".mp3";
+}
+
+bool SampleIndex::matches (const juce::File& root, const juce::File& file, const juce::String& query)
+{
+    return isAudioFile (file) && file.isAChildOf (root)
+           && matches (makeEntry (root, file), toLowerPath (query.trim()));
+}
+
+SampleIndex::Entry SampleIndex::makeEntry (const juce::File& root, const juce::File& file)
+{
+    Entry entry;
+    entry.file = file;
+    entry.lowerPath = toLowerPath (file.getRelativePathFrom (root));
+
+    auto slash = entry.lowerPath.rfind ('/');
+    entry.nameStart = slash == std::string::npos ? 0 : slash + 1;
+
+    auto dot = entry.lowerPath.rfind ('.');
+    entry.nameEnd = dot == std::string::npos || dot < entry.nameStart ? entry.lowerPath.size() : dot;
+
+    return entry;
+}
+
+bool SampleIndex::matches (const Entry& entry, const std::string& needle)
+{
+    std::string_view haystack (entry.lowerPath);
+
+    if (needle.find ('/') != std::string::npos)
+        haystack = haystack.substr (0, entry.nameEnd);
+    else
+        haystack = haystack.substr (entry.nameStart, entry.nameEnd - entry.nameStart);
+
+    return haystack.find (needle) != std::string_view::npos;
+}
+
+void SampleIndex::setRoot (const juce::File& dir)
+{
+    {
+        std::lock_guard<std::mutex> lock (requestMutex);
+        if (dir == requestedRoot)
+            return;
+
+        requestedRoot = dir;
+        pendingChanges.clear();
+    }
+
+    rootChanged.store (true);
+    notify();
+}
+
+void SampleIndex::applyChanges (const DirectoryWatcher::ChangeSet& changeSet)
+{
+    {
+        std::lock_guard<std::mutex> lock (requestMutex);
+        pendingChanges.push_back (changeSet);
+    }
+
+    notify();
+}
+
+int SampleIndex::search (const juce::String& query)
+{
+    int searchId;
+    {
+        std::lock_guard<std::mutex> lock (requestMutex);
+        searchId = ++searchGeneration;
+        pendingQuery = query;
+        pendingSearchId = searchId;
+    }
+
+    notify();
+    return searchId;
+}
+
+void SampleIndex::cancelSearch()
+{
+    std::lock_guard<std::mutex> lock (requestMutex);
+    ++searchGeneration;
+    pendingSearchId = 0;
+}
+
+void SampleIndex::setResultsCallback (ResultsCallback callback)
+{
+    std::lock_guard<std::mutex> lock (callbackMutex);
+    onResults = std::move (callback);
+}
+
+//==============================================================================
+void SampleIndex::run()
+{
+    while (! threadShouldExit())
+    {
+        wait (-1);
+
+        while (! threadShouldExit())
+        {
+            bool rebuild = rootChanged.exchange (false);
+            juce::File newRoot;
+            std::vector<DirectoryWatcher::ChangeSet> changes;
+            juce::String query;
+            int searchId;
+
+            {
+                std::lock_guard<std::mutex> lock (requestMutex);
+                newRoot = requestedRoot;
+                changes.swap (pendingChanges);
+                query = pendingQuery;
+                searchId = std::exchange (pendingSearchId, 0);
+            }
+
+            if (! rebuild && changes.empty() && searchId == 0)
+                break;
+
+            if (rebuild)
+                build (newRoot);
+
+            for (auto& changeSet : changes)
+                apply (changeSet);
+
+            if (numDead > 1024 && numDead > entries.size() / 2)
+                compact();
+
+            if (searchId != 0)
+                runSearch (query, searchId);
+        }
+    }
+}
+
+void SampleIndex::build (const juce::File& newRoot)
+{
+    clear();
+    root = newRoot;
+
+    if (! root.isDirectory())
+        return;
+
+    for (const auto& entry : juce::RangedDirectoryIterator (root, true, "*", juce::File::findFiles))
+    {
+        // Started again with the new root on the next pass
+        if (threadShouldExit() || rootChanged.load())
+            return;
+
+        if (isAudioFile (entry.getFile()))
+            add (entry.getFile());
+    }
+}
+
+void SampleIndex::apply (const DirectoryWatcher::ChangeSet& changeSet)
+{
+    if (changeSet.root != root)
+        return;
+
+    if (changeSet.overflowed)
+    {
+        build (root);
+        return;
+    }
+
+    for (auto& change : changeSet.changes)
+    {
+        if (change.isDirectory)
+        {
+            remove (change.file);
+
+            if (change.type != DirectoryWatcher::Change::Type::deleted)
+                addDirectory (change.file);
+        }
+        else if (change.type == DirectoryWatcher::Change::Type::deleted)
+        {
+            remove (change.file);
+        }
+        else if (isAudioFile (change.file) && change.file.existsAsFile())
+        {
+            add (change.file);
+        }
+    }
+}
+
+void SampleIndex::compact()
+{
+    std::vector<juce::File> files;
+    for (auto& entry : entries)
+        if (entry.alive)
+            files.push_back (entry.file);
+
+    clear();
+
+    for (auto& file : files)
+        add (file);
+}
+
+//==============================================================================
+void SampleIndex::add (const juce::File& file)
+{
+    auto path = file.getFullPathName();
+    if (idsByPath.find (path) != idsByPath.end())
+        return;
+
+    auto id = (juce::uint32) entries.size();
+    auto entry = makeEntry (root, file);
+
+    for (size_t i = 0; i + 3 <= entry.lowerPath.size(); ++i)
+    {
+        auto& ids = trigrams[trigramAt (entry.lowerPath, i)];
+        if (ids.empty() || ids.back() != id)
+            ids.push_back (id);
+    }
+
+    entries.push_back (std::move (entry));
+    idsByPath[path] = id;
+}
+
+void SampleIndex::addDirectory (const juce::File& dir)
+{
+    if (! dir.isDirectory())
+        return;
+
+    for (const auto& entry : juce::RangedDirectoryIterator (dir, true, "*", juce::File::findFiles))
+        if (isAudioFile (entry.getFile()))
+            add (entry.getFile());
+}
+
+// Entries are only marked dead; their trigram postings go at the next compact()
+void SampleIndex::remove (const juce::File& fileOrDir)
+{
+    auto kill = [this] (std::map<juce::String, juce::uint32>::iterator it)
+    {
+        entries[it->second].alive = false;
+        ++numDead;
+        return idsByPath.erase (it);
+    };
+
+    if (auto exact = idsByPath.find (fileOrDir.getFullPathName()); exact != idsByPath.end())
+        kill (exact);
+
+    auto prefix = fileOrDir.getFullPathName() + juce::File::getSeparatorString();
+    for (auto it = idsByPath.lower_bound (prefix); it != idsByPath.end() && it->first.startsWith (prefix);)
+        it = kill (it);
+}
+
+void SampleIndex::clear()
+{
+    entries.clear();
+    trigrams.clear();
+    idsByPath.clear();
+    numDead = 0;
+}
+
+//==============================================================================
+void SampleIndex::runSearch (const juce::String& query, int searchId)
+{
+    auto needle = toLowerPath (query.trim());
+    if (needle.empty())
+        return;
+
+    // Every match contains all of the query's trigrams, so the rarest one's
+    // postings are the only candidates
+    const std::vector<juce::uint32>* candidates = nullptr;
+
+    for (size_t i = 0; i + 3 <= needle.size(); ++i)
+    {
+        auto found = trigrams.find (trigramAt (needle, i));
+        if (found == trigrams.end())
+            return;
+
+        if (candidates == nullptr || found->second.size() < candidates->size())
+            candidates = &found->second;
+    }
+
+    juce::Array<juce::File> batch;
+
+    auto deliver = [&]
+    {
+        if (! batch.isEmpty() && searchGeneration.load() == searchId)
+        {
+            std::lock_guard<std::mutex> lock (callbackMutex);
+            if (onResults)
+                onResults (searchId, batch);
+        }
+
+        batch.clearQuick();
+    };
+
+    auto consider = [&] (juce::uint32 id)
+    {
+        auto& entry = entries[id];
+        if (! entry.alive || ! matches (entry, needle))
+            return;
+
+        batch.add (entry.file);
+        if (batch.size() >= kResultBatchSize)
+            deliver();
+    };
+
+    const auto numCandidates = candidates != nullptr ? candidates->size() : entries.size();
+
+    for (size_t i = 0; i < numCandidates; ++i)
+    {
+        // A newer search or a change to apply takes over
+        if ((i & 1023) == 0 && (searchGeneration.load() != searchId || threadShouldExit()))
+            return;
+
+        consider (candidates != nullptr ? (*candidates)[i] : (juce::uint32) i);
+    }
+
+    deliver();
+}
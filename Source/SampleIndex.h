@@ -0,0 +1,91 @@
+#pragma once
+#include <juce_core/juce_core.h>
+#include "DirectoryWatcher.h"
+#include <atomic>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// In-memory index of the audio files under the samples directory, for the
+// sample browser's search. Built on a background thread and kept current
+// from DirectoryWatcher change sets rather than by re-listing the tree.
+//
+// Relative paths are indexed by trigram, so a search only checks the files
+// that contain the query's rarest trigram. Searches run on the index thread
+// and stream their results back in batches.
+class SampleIndex : private juce::Thread
+{
+public:
+    SampleIndex();
+    ~SampleIndex() override;
+
+    // Re-indexes from scratch if dir isn't the current root.
+    void setRoot (const juce::File& dir);
+    void applyChanges (const DirectoryWatcher::ChangeSet& changeSet);
+
+    // Starts a case-insensitive substring search of file names, or of paths
+    // relative to the root if the query contains a separator, and abandons
+    // any search still running. Returns the id its results carry.
+    int search (const juce::String& query);
+    void cancelSearch();
+
+    // Called on the index thread with each batch of results. Setting it waits
+    // for a batch being delivered to the old callback, so after clearing it
+    // the old one is never called again.
+    using ResultsCallback = std::function<void (int searchId, const juce::Array<juce::File>& files)>;
+    void setResultsCallback (ResultsCallback callback);
+
+    static bool isAudioFile (const juce::File& f);
+
+    // Whether search (query) would return file, for patching shown results.
+    static bool matches (const juce::File& root, const juce::File& file, const juce::String& query);
+
+    static constexpr int kResultBatchSize = 256;
+
+private:
+    struct Entry
+    {
+        juce::File file;
+        std::string lowerPath;      // relative, '/'-separated, lowercase UTF-8
+        size_t nameStart = 0;       // the file name within lowerPath,
+        size_t nameEnd = 0;         // without its extension
+        bool alive = true;
+    };
+
+    std::mutex requestMutex;
+    juce::File requestedRoot;
+    std::vector<DirectoryWatcher::ChangeSet> pendingChanges;
+    juce::String pendingQuery;
+    int pendingSearchId = 0;
+    std::atomic<bool> rootChanged { false };
+
+    std::mutex callbackMutex;
+    ResultsCallback onResults;
+    std::atomic<int> searchGeneration { 0 };
+
+    // Only touched on the index thread
+    juce::File root;
+    std::vector<Entry> entries;
+    std::unordered_map<juce::uint32, std::vector<juce::uint32>> trigrams;    // entry ids, ascending
+    std::map<juce::String, juce::uint32> idsByPath;     // live entries by full path
+    size_t numDead = 0;
+
+    void run() override;
+    void build (const juce::File& newRoot);
+    void apply (const DirectoryWatcher::ChangeSet& changeSet);
+    void compact();
+    void runSearch (const juce::String& query, int searchId);
+
+    static Entry makeEntry (const juce::File& root, const juce::File& file);
+    static bool matches (const Entry& entry, const std::string& needle);
+
+    void add (const juce::File& file);
+    void addDirectory (const juce::File& dir);
+    void remove (const juce::File& fileOrDir);
+    void clear();
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (SampleIndex)
+};
@@ -0,0 +1,93 @@
+#include "SamplePool.h"
+#include <vector>
+
+SamplePool::SamplePool()
+{
+    releasePool->addCollector (this);
+}
+
+SamplePool::~SamplePool()
+{
+    releasePool->removeCollector (this);
+}
+
+SamplePool::Key SamplePool::makeKey (const juce::File& file, double sampleRate,
+                                     Resampler::Quality quality, bool resident)
+{
+    return { file.getFullPathName(), file.getSize(),
+             file.getLastModificationTime().toMilliseconds(), sampleRate, (int) quality, resident };
+}
+
+SampleData::Ptr SamplePool::getOrLoad (const juce::File& file, double sampleRate,
+                                       Resampler::Quality quality, bool resident, const Loader& load)
+{
+    const auto key = makeKey (file, sampleRate, quality, resident);
+
+    {
+        std::unique_lock<std::mutex> lock (mutex);
+
+        loadFinished.wait (lock, [this, &key]
+        {
+            auto it = entries.find (key);
+            return it == entries.end() || ! it->second.loading;
+        });
+
+        auto& entry = entries[key];
+        if (entry.data != nullptr)
+            return entry.data;
+
+        entry.loading = true;
+    }
+
+    auto data = load();
+    if (data != nullptr)
+        data->pooled = true;
+
+    {
+        std::lock_guard<std::mutex> lock (mutex);
+
+        if (data != nullptr)
+            entries[key] = { data, false };
+        else
+            entries.erase (key);
+    }
+
+    loadFinished.notify_all();
+    return data;
+}
+
+SampleData::Ptr SamplePool::find (const juce::File& file, double sampleRate,
+                                  Resampler::Quality quality, bool resident)
+{
+    const auto key = makeKey (file, sampleRate, quality, resident);
+
+    std::lock_guard<std::mutex> lock (mutex);
+    auto it = entries.find (key);
+    return it != entries.end() ? it->second.data : nullptr;
+}
+
+void SamplePool::collectGarbage()
+{
+    std::vector<SampleData::Ptr> unused;
+
+    {
+        std::lock_guard<std::mutex> lock (mutex);
+
+        for (auto it = entries.begin(); it != entries.end();)
+        {
+            auto& data = it->second.data;
+            if (data != nullptr && data->getReferenceCount() == 1)
+            {
+                unused.push_back (std::move (data));
+                it = entries.erase (it);
+            }
+            else
+            {
+                ++it;
+            }
+        }
+    }
+
+    // Freed here, outside the lock
+    unused.clear();
+}
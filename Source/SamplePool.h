@@ -0,0 +1,57 @@
+#pragma once
+#include <juce_core/juce_core.h>
+#include "ReleasePool.h"
+#include "Resampler.h"
+#include "SampleData.h"
+#include <condition_variable>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <tuple>
+
+// Process-wide set of loaded samples, keyed by file identity (path, size,
+// modification time) plus the rate and quality they were converted at.
+// Pads and presets that use the same file share one SampleData, and a file
+// being loaded by one thread is waited for rather than decoded twice.
+// Resident samples (see SampleData::resident) are pooled apart from the
+// mapped ones of the same file.
+//
+// An entry is dropped once the pool holds its only reference; that check
+// runs on the ReleasePool thread. Shared through juce::SharedResourcePointer.
+class SamplePool : private ReleasePool::Collector
+{
+public:
+    SamplePool();
+    ~SamplePool() override;
+
+    using Loader = std::function<SampleData::Ptr()>;
+
+    // Returns the pooled sample for the file, calling load to create it if
+    // there isn't one yet. Returns nullptr if load does.
+    SampleData::Ptr getOrLoad (const juce::File& file, double sampleRate,
+                               Resampler::Quality quality, bool resident, const Loader& load);
+
+    // The pooled sample if it is already loaded, without waiting or loading.
+    SampleData::Ptr find (const juce::File& file, double sampleRate, Resampler::Quality quality, bool resident);
+
+private:
+    using Key = std::tuple<juce::String, juce::int64, juce::int64, double, int, bool>;
+
+    static Key makeKey (const juce::File& file, double sampleRate, Resampler::Quality quality, bool resident);
+
+    struct Entry
+    {
+        SampleData::Ptr data;
+        bool loading = false;
+    };
+
+    std::mutex mutex;
+    std::condition_variable loadFinished;
+    std::map<Key, Entry> entries;
+
+    juce::SharedResourcePointer<ReleasePool> releasePool;
+
+    void collectGarbage() override;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (SamplePool)
+};
@@ -0,0 +1,80 @@
+#pragma once
+
+#if defined (__AVX2__)
+ #define BEATWERK_SIMD_AVX2 1
+ #include <immintrin.h>
+#elif defined (__SSE2__) || defined (_M_X64) || (defined (_M_IX86_FP) && _M_IX86_FP >= 2)
+ #define BEATWERK_SIMD_SSE 1
+ #include <emmintrin.h>
+#elif defined (__ARM_NEON) || defined (__ARM_NEON__) || defined (_M_ARM64)
+ #define BEATWERK_SIMD_NEON 1
+ #include <arm_neon.h>
+#endif
+
+#if BEATWERK_SIMD_AVX2 || BEATWERK_SIMD_SSE || BEATWERK_SIMD_NEON
+ #define BEATWERK_SIMD 1
+#endif
+
+// The handful of float vector operations the DSP kernels need, mapped onto
+// whichever instruction set the build targets. Loads and stores are
+// unaligned.
+namespace SimdOps
+{
+   #if BEATWERK_SIMD_AVX2
+    using Vec = __m256;
+    constexpr int width = 8;
+    inline Vec load (const float* p) noexcept           { return _mm256_loadu_ps (p); }
+    inline void store (float* p, Vec v) noexcept        { _mm256_storeu_ps (p, v); }
+    inline Vec splat (float x) noexcept                 { return _mm256_set1_ps (x); }
+    inline Vec add (Vec a, Vec b) noexcept              { return _mm256_add_ps (a, b); }
+    inline Vec mulAdd (Vec acc, Vec a, Vec b) noexcept  { return _mm256_add_ps (acc, _mm256_mul_ps (a, b)); }
+    inline Vec ramp (float start, float step) noexcept
+    {
+        return _mm256_setr_ps (start,            start + step,        start + 2.0f * step, start + 3.0f * step,
+                               start + 4.0f * step, start + 5.0f * step, start + 6.0f * step, start + 7.0f * step);
+    }
+    inline float sum (Vec v) noexcept
+    {
+        auto s = _mm_add_ps (_mm256_castps256_ps128 (v), _mm256_extractf128_ps (v, 1));
+        s = _mm_add_ps (s, _mm_movehl_ps (s, s));
+        s = _mm_add_ss (s, _mm_shuffle_ps (s, s, 1));
+        return _mm_cvtss_f32 (s);
+    }
+   #elif BEATWERK_SIMD_SSE
+    using Vec = __m128;
+    constexpr int width = 4;
+    inline Vec load (const float* p) noexcept           { return _mm_loadu_ps (p); }
+    inline void store (float* p, Vec v) noexcept        { _mm_storeu_ps (p, v); }
+    inline Vec splat (float x) noexcept                 { return _mm_set1_ps (x); }
+    inline Vec add (Vec a, Vec b) noexcept              { return _mm_add_ps (a, b); }
+    inline Vec mulAdd (Vec acc, Vec a, Vec b) noexcept  { return _mm_add_ps (acc, _mm_mul_ps (a, b)); }
+    inline Vec ramp (float start, float step) noexcept
+    {
+        return _mm_setr_ps (start, start + step, start + 2.0f * step, start + 3.0f * step);
+    }
+    inline float sum (Vec v) noexcept
+    {
+        auto s = _mm_add_ps (v, _mm_movehl_ps (v, v));
+        s = _mm_add_ss (s, _mm_shuffle_ps (s, s, 1));
+        return _mm_cvtss_f32 (s);
+    }
+   #elif BEATWERK_SIMD_NEON
+    using Vec = float32x4_t;
+    constexpr int width = 4;
+    inline Vec load (const float* p) noexcept           { return vld1q_f32 (p); }
+    inline void store (float* p, Vec v) noexcept        { vst1q_f32 (p, v); }
+    inline Vec splat (float x) noexcept                 { return vdupq_n_f32 (x); }
+    inline Vec add (Vec a, Vec b) noexcept              { return vaddq_f32 (a, b); }
+    inline Vec mulAdd (Vec acc, Vec a, Vec b) noexcept  { return vmlaq_f32 (acc, a, b); }
+    inline Vec ramp (float start, float step) noexcept
+    {
+        const float lanes[4] = { start, start + step, start + 2.0f * step, start + 3.0f * step };
+        return vld1q_f32 (lanes);
+    }
+    inline float sum (Vec v) noexcept
+    {
+        auto pair = vadd_f32 (vget_low_f32 (v), vget_high_f32 (v));
+        return vget_lane_f32 (vpadd_f32 (pair, pair), 0);
+    }
+   #endif
+}
@@ -0,0 +1,435 @@
+#include "ThumbnailCache.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace
+{
+    constexpr char kMagic[4] = { 'B', 'W', 'T', 'H' };
+    constexpr int kVersion = 2;
+    constexpr int kRecordMagic = 0x52545742;   // "BWTR" little-endian
+    constexpr int kReadBlockSize = 65536;
+
+    juce::uint8 toLevel (float value)
+    {
+        return (juce::uint8) juce::jlimit (0, 255, juce::roundToInt (value * 255.0f));
+    }
+}
+
+//==============================================================================
+void ThumbnailCache::Thumbnail::draw (juce::Graphics& g, juce::Rectangle<float> area,
+                                      juce::Colour peakColour, juce::Colour rmsColour) const
+{
+    const int numBins = (int) peaks.size();
+    const int numColumns = (int) area.getWidth();
+
+    if (numBins == 0 || numColumns <= 0 || area.getHeight() <= 0.0f)
+        return;
+
+    const float columnWidth = area.getWidth() / (float) numColumns;
+    const float halfHeight = area.getHeight() * 0.5f;
+    const float centre = area.getCentreY();
+
+    juce::RectangleList<float> peakRects, rmsRects;
+
+    for (int x = 0; x < numColumns; ++x)
+    {
+        const int first = x * numBins / numColumns;
+        const int last = juce::jmax (first + 1, (x + 1) * numBins / numColumns);
+
+        juce::uint8 peak = 0, level = 0;
+        for (int bin = first; bin < last; ++bin)
+        {
+            peak = juce::jmax (peak, peaks[(size_t) bin]);
+            level = juce::jmax (level, rms[(size_t) bin]);
+        }
+
+        const float left = area.getX() + (float) x * columnWidth;
+        const float peakHeight = juce::jmax (0.5f, halfHeight * (float) peak / 255.0f);
+        const float rmsHeight = halfHeight * (float) level / 255.0f;
+
+        peakRects.addWithoutMerging ({ left, centre - peakHeight, columnWidth, peakHeight * 2.0f });
+        if (rmsHeight > 0.0f)
+            rmsRects.addWithoutMerging ({ left, centre - rmsHeight, columnWidth, rmsHeight * 2.0f });
+    }
+
+    g.setColour (peakColour);
+    g.fillRectList (peakRects);
+    g.setColour (rmsColour);
+    g.fillRectList (rmsRects);
+}
+
+//==============================================================================
+ThumbnailCache::ThumbnailCache()
+    : juce::Thread ("Beatwerk thumbnails")
+{
+    formatManager.registerBasicFormats();
+
+    auto appData = juce::File::getSpecialLocation (juce::File::userApplicationDataDirectory);
+    packFile = appData.getChildFile ("Beatwerk/Thumbnails.bwth");
+
+    startThread (juce::Thread::Priority::low);
+}
+
+ThumbnailCache::~ThumbnailCache()
+{
+    stopThread (5000);
+}
+
+ThumbnailCache::ThumbnailPtr ThumbnailCache::get (const juce::File& file)
+{
+    if (file == juce::File())
+        return nullptr;
+
+    auto path = file.getFullPathName();
+
+    {
+        std::lock_guard<std::mutex> lock (mutex);
+
+        if (auto it = memory.find (path); it != memory.end())
+        {
+            it->second.lastUsed = ++useCounter;
+            return it->second.thumbnail;
+        }
+
+        if (unreadable.count (path) != 0 || ! queued.insert (path).second)
+            return nullptr;
+
+        queue.push_back (file);
+    }
+
+    notify();
+    return nullptr;
+}
+
+void ThumbnailCache::forget (const juce::File& file)
+{
+    std::lock_guard<std::mutex> lock (mutex);
+    memory.erase (file.getFullPathName());
+    unreadable.erase (file.getFullPathName());
+}
+
+//==============================================================================
+void ThumbnailCache::run()
+{
+    openPack();
+
+    while (! threadShouldExit())
+    {
+        juce::File file;
+
+        {
+            std::lock_guard<std::mutex> lock (mutex);
+
+            if (! queue.empty())
+            {
+                file = queue.back();
+                queue.pop_back();
+            }
+        }
+
+        if (file == juce::File())
+        {
+            wait (-1);
+            continue;
+        }
+
+        auto thumbnail = load (file);
+        if (threadShouldExit())
+            break;
+
+        {
+            std::lock_guard<std::mutex> lock (mutex);
+            auto path = file.getFullPathName();
+            queued.erase (path);
+
+            if (thumbnail == nullptr)
+            {
+                unreadable.insert (path);
+                continue;
+            }
+
+            if (memory.size() >= kMaxInMemory)
+            {
+                memory.erase (std::min_element (memory.begin(), memory.end(), [] (const auto& a, const auto& b)
+                {
+                    return a.second.lastUsed < b.second.lastUsed;
+                }));
+            }
+
+            memory[path] = { thumbnail, ++useCounter };
+        }
+
+        sendChangeMessage();
+    }
+}
+
+ThumbnailCache::ThumbnailPtr ThumbnailCache::load (const juce::File& file)
+{
+    if (! file.existsAsFile())
+        return nullptr;
+
+    Record current;
+    current.size = file.getSize();
+    current.modificationTime = file.getLastModificationTime().toMilliseconds();
+
+    auto path = file.getFullPathName();
+
+    if (auto it = records.find (path); it != records.end()
+        && it->second.size == current.size && it->second.modificationTime == current.modificationTime)
+    {
+        if (auto thumbnail = readRecord (path, it->second))
+            return thumbnail;
+    }
+
+    auto thumbnail = build (file);
+    if (thumbnail != nullptr)
+        appendRecord (path, current, *thumbnail);
+
+    return thumbnail;
+}
+
+ThumbnailCache::ThumbnailPtr ThumbnailCache::build (const juce::File& file)
+{
+    std::unique_ptr<juce::AudioFormatReader> reader (formatManager.createReaderFor (file));
+    if (reader == nullptr || reader->lengthInSamples <= 0)
+        return nullptr;
+
+    const auto length = reader->lengthInSamples;
+    const int numChannels = juce::jlimit (1, 2, (int) reader->numChannels);
+
+    std::vector<float> peaks (kNumBins, 0.0f);
+    std::vector<double> sumSquares (kNumBins, 0.0);
+    std::vector<juce::int64> counts (kNumBins, 0);
+
+    juce::AudioBuffer<float> block (numChannels, kReadBlockSize);
+
+    for (juce::int64 start = 0; start < length; start += kReadBlockSize)
+    {
+        if (threadShouldExit())
+            return nullptr;
+
+        const int numSamples = (int) juce::jmin ((juce::int64) kReadBlockSize, length - start);
+        reader->read (&block, 0, numSamples, start, true, numChannels > 1);
+
+        for (int ch = 0; ch < numChannels; ++ch)
+        {
+            const float* samples = block.getReadPointer (ch);
+
+            for (int i = 0; i < numSamples; ++i)
+            {
+                const auto bin = (size_t) ((start + i) * kNumBins / length);
+                const float value = samples[i];
+
+                peaks[bin] = juce::jmax (peaks[bin], std::abs (value));
+                sumSquares[bin] += (double) value * value;
+                ++counts[bin];
+            }
+        }
+    }
+
+    auto thumbnail = std::make_shared<Thumbnail>();
+    thumbnail->peaks.resize (kNumBins);
+    thumbnail->rms.resize (kNumBins);
+
+    for (size_t bin = 0; bin < (size_t) kNumBins; ++bin)
+    {
+        thumbnail->peaks[bin] = toLevel (peaks[bin]);
+        thumbnail->rms[bin] = counts[bin] > 0 ? toLevel ((float) std::sqrt (sumSquares[bin] / (double) counts[bin]))
+                                              : 0;
+    }
+
+    return thumbnail;
+}
+
+//==============================================================================
+void ThumbnailCache::openPack()
+{
+    const auto binsBytes = (juce::int64) kNumBins * 2;
+    juce::int64 totalLength = 0, validEnd = 0;
+    int numRecords = 0;
+
+    juce::InterProcessLock::ScopedLockType lock (packLock);
+
+    {
+        juce::FileInputStream in (packFile);
+        if (! in.openedOk())
+            return;
+
+        char magic[4] = {};
+        in.read (magic, sizeof (magic));
+
+        if (std::memcmp (magic, kMagic, sizeof (kMagic)) != 0 || in.readInt() != kVersion)
+        {
+            records.clear();
+            packFile.deleteFile();
+            return;
+        }
+
+        totalLength = in.getTotalLength();
+        validEnd = in.getPosition();
+
+        while (! in.isExhausted())
+        {
+            juce::String path;
+            Record record;
+            record.offset = in.getPosition();
+
+            if (! readRecordHeader (in, path, record) || in.getPosition() + binsBytes > totalLength)
+                break;
+
+            in.setPosition (in.getPosition() + binsBytes);
+            validEnd = in.getPosition();
+
+            // Later records replace earlier ones for the same file
+            records[path] = record;
+            ++numRecords;
+        }
+    }
+
+    // A record cut short by a crash would garble everything appended after it
+    if (validEnd < totalLength)
+    {
+        juce::FileOutputStream out (packFile);
+        if (out.openedOk() && out.setPosition (validEnd))
+            out.truncate();
+    }
+
+    if (numRecords > kMaxRecords || numRecords > (int) records.size() * 2 + 1024)
+        compactPack();
+}
+
+// Rewrites the pack with only the latest record of each file, dropping the
+// oldest ones beyond kMaxRecords * 3 / 4
+void ThumbnailCache::compactPack()
+{
+    std::vector<std::pair<juce::String, Record>> live (records.begin(), records.end());
+    std::sort (live.begin(), live.end(), [] (const auto& a, const auto& b)
+    {
+        return a.second.offset < b.second.offset;
+    });
+
+    const auto keep = juce::jmin (live.size(), (size_t) kMaxRecords * 3 / 4);
+    live.erase (live.begin(), live.end() - (std::ptrdiff_t) keep);
+
+    std::map<juce::String, Record> compacted;
+    juce::TemporaryFile temp (packFile);
+
+    {
+        juce::FileInputStream in (packFile);
+        juce::FileOutputStream out (temp.getFile());
+        if (! in.openedOk() || ! out.openedOk())
+            return;
+
+        out.write (kMagic, sizeof (kMagic));
+        out.writeInt (kVersion);
+
+        std::vector<char> bins ((size_t) kNumBins * 2);
+
+        for (auto& [path, record] : live)
+        {
+            juce::String storedPath;
+            Record stored;
+
+            if (! in.setPosition (record.offset) || ! readRecordHeader (in, storedPath, stored)
+                || storedPath != path || in.read (bins.data(), (int) bins.size()) != (int) bins.size())
+                continue;
+
+            auto moved = record;
+            moved.offset = out.getPosition();
+            writeRecordHeader (out, path, moved);
+            out.write (bins.data(), bins.size());
+
+            compacted[path] = moved;
+        }
+
+        out.flush();
+        if (out.getStatus().failed())
+            return;
+    }
+
+    if (temp.overwriteTargetFileWithTemporary())
+        records = std::move (compacted);
+}
+
+// Another process may have compacted the pack since the record was found, so
+// it only counts if the header there still describes this version of the file
+ThumbnailCache::ThumbnailPtr ThumbnailCache::readRecord (const juce::String& path, const Record& record)
+{
+    juce::InterProcessLock::ScopedLockType lock (packLock);
+
+    juce::FileInputStream in (packFile);
+    if (! in.openedOk() || ! in.setPosition (record.offset))
+        return nullptr;
+
+    juce::String storedPath;
+    Record stored;
+
+    if (! readRecordHeader (in, storedPath, stored) || storedPath != path
+        || stored.size != record.size || stored.modificationTime != record.modificationTime)
+        return nullptr;
+
+    auto thumbnail = std::make_shared<Thumbnail>();
+    thumbnail->peaks.resize (kNumBins);
+    thumbnail->rms.resize (kNumBins);
+
+    if (in.read (thumbnail->peaks.data(), kNumBins) != kNumBins
+        || in.read (thumbnail->rms.data(), kNumBins) != kNumBins)
+        return nullptr;
+
+    return thumbnail;
+}
+
+void ThumbnailCache::appendRecord (const juce::String& path, Record record, const Thumbnail& thumbnail)
+{
+    if (! packFile.getParentDirectory().createDirectory())
+        return;
+
+    juce::InterProcessLock::ScopedLockType lock (packLock);
+
+    juce::FileOutputStream out (packFile);
+    if (! out.openedOk())
+        return;
+
+    if (out.getPosition() == 0)
+    {
+        out.write (kMagic, sizeof (kMagic));
+        out.writeInt (kVersion);
+    }
+
+    record.offset = out.getPosition();
+    writeRecordHeader (out, path, record);
+    out.write (thumbnail.peaks.data(), thumbnail.peaks.size());
+    out.write (thumbnail.rms.data(), thumbnail.rms.size());
+
+    out.flush();
+    if (! out.getStatus().failed())
+        records[path] = record;
+}
+
+//==============================================================================
+// A record is its magic, the path's hash, the path, the file's size and
+// modification time and the bin count, followed by the bins
+bool ThumbnailCache::readRecordHeader (juce::InputStream& in, juce::String& path, Record& record)
+{
+    if (in.readInt() != kRecordMagic)
+        return false;
+
+    const auto pathHash = in.readInt64();
+    path = in.readString();
+    record.size = in.readInt64();
+    record.modificationTime = in.readInt64();
+    const auto numBins = (int) in.readShort();
+
+    return ! in.isExhausted() && path.isNotEmpty() && path.hashCode64() == pathHash && numBins == kNumBins;
+}
+
+void ThumbnailCache::writeRecordHeader (juce::OutputStream& out, const juce::String& path, const Record& record)
+{
+    out.writeInt (kRecordMagic);
+    out.writeInt64 (path.hashCode64());
+    out.writeString (path);
+    out.writeInt64 (record.size);
+    out.writeInt64 (record.modificationTime);
+    out.writeShort ((short) kNumBins);
+}
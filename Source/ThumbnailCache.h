@@ -0,0 +1,99 @@
+#pragma once
+#include <juce_audio_formats/juce_audio_formats.h>
+#include <juce_graphics/juce_graphics.h>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <vector>
+
+// Waveform overviews for pads and sample browser rows, keyed by the sample's
+// file as reported by SampleEngine::getSampleFile.
+//
+// Lookups only ever touch memory. A missing thumbnail is queued for a
+// background worker, which reads it from the on-disk pack or, failing that,
+// decodes the file and appends it there; listeners get a change message
+// once it is ready. The pack holds one record per file, its path, size and
+// modification time followed by a peak and an RMS byte per bin, and is
+// compacted when it has grown past kMaxRecords or is mostly stale.
+//
+// Several processes may share the pack, e.g. sandboxed plugin instances, so
+// it is only opened, compacted, read or appended to under an
+// InterProcessLock, and each record's header is checked against the file it
+// is expected to hold before its bins are used.
+//
+// Shared process-wide through juce::SharedResourcePointer.
+class ThumbnailCache : public juce::ChangeBroadcaster,
+                       private juce::Thread
+{
+public:
+    struct Thumbnail
+    {
+        // Per bin, over all channels, with 255 for full scale
+        std::vector<juce::uint8> peaks;
+        std::vector<juce::uint8> rms;
+
+        void draw (juce::Graphics& g, juce::Rectangle<float> area,
+                   juce::Colour peakColour, juce::Colour rmsColour) const;
+    };
+
+    using ThumbnailPtr = std::shared_ptr<const Thumbnail>;
+
+    ThumbnailCache();
+    ~ThumbnailCache() override;
+
+    // nullptr until the worker has the thumbnail, or if the file can't be read.
+    ThumbnailPtr get (const juce::File& file);
+
+    // Drops the in-memory thumbnail of a file that changed; the pack record
+    // no longer matches it and is replaced on the next get().
+    void forget (const juce::File& file);
+
+    static constexpr int kNumBins = 128;
+    static constexpr size_t kMaxInMemory = 4096;
+    static constexpr int kMaxRecords = 100000;
+
+private:
+    struct MemoryEntry
+    {
+        ThumbnailPtr thumbnail;
+        juce::uint64 lastUsed = 0;
+    };
+
+    struct Record
+    {
+        juce::int64 size = 0;
+        juce::int64 modificationTime = 0;
+        juce::int64 offset = 0;         // where its header starts in the pack
+    };
+
+    std::mutex mutex;
+    std::map<juce::String, MemoryEntry> memory;
+    std::set<juce::String> unreadable;
+    std::deque<juce::File> queue;       // newest last; served newest first
+    std::set<juce::String> queued;
+    juce::uint64 useCounter = 0;
+
+    // Worker thread only
+    juce::AudioFormatManager formatManager;
+    juce::File packFile;
+    juce::InterProcessLock packLock { "BeatwerkThumbnailPack" };
+    std::map<juce::String, Record> records;     // as this process last saw the pack
+
+    void run() override;
+    ThumbnailPtr load (const juce::File& file);
+    ThumbnailPtr build (const juce::File& file);
+
+    // All of these lock the pack, apart from compactPack, which openPack
+    // calls with it locked
+    void openPack();
+    void compactPack();
+    ThumbnailPtr readRecord (const juce::String& path, const Record& record);
+    void appendRecord (const juce::String& path, Record record, const Thumbnail& thumbnail);
+
+    static bool readRecordHeader (juce::InputStream& in, juce::String& path, Record& record);
+    static void writeRecordHeader (juce::OutputStream& out, const juce::String& path, const Record& record);
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (ThumbnailCache)
+};
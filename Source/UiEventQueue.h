@@ -0,0 +1,53 @@
+#pragma once
+#include <juce_core/juce_core.h>
+#include <array>
+
+// Fixed-capacity single-producer/single-consumer queue of events from the
+// audio thread to the editor. push() never allocates or blocks; when the
+// editor isn't draining, e.g. because it is closed, new events are dropped.
+class UiEventQueue
+{
+public:
+    struct Event
+    {
+        enum class Type : juce::uint8 { trigger, navigate, programChange, learn };
+
+        Type type = Type::trigger;
+        int value = 0;          // note, step (+1/-1), program or learned CC
+        int target = 0;         // MidiMapper::LearnTarget for learn events
+        float velocity = 0.0f;
+        double timeMs = 0.0;    // juce::Time::getMillisecondCounterHiRes() when pushed
+    };
+
+    // Audio thread only.
+    bool push (Event event) noexcept
+    {
+        event.timeMs = juce::Time::getMillisecondCounterHiRes();
+
+        const auto scope = fifo.write (1);
+        if (scope.blockSize1 + scope.blockSize2 == 0)
+            return false;
+
+        events[(size_t) (scope.blockSize1 > 0 ? scope.startIndex1 : scope.startIndex2)] = event;
+        return true;
+    }
+
+    // Message thread only. Calls handler for every queued event, oldest first.
+    template <typename Handler>
+    void drain (Handler&& handler)
+    {
+        const auto scope = fifo.read (fifo.getNumReady());
+
+        for (int i = 0; i < scope.blockSize1; ++i)
+            handler (events[(size_t) (scope.startIndex1 + i)]);
+
+        for (int i = 0; i < scope.blockSize2; ++i)
+            handler (events[(size_t) (scope.startIndex2 + i)]);
+    }
+
+    static constexpr int kCapacity = 1024;
+
+private:
+    juce::AbstractFifo fifo { kCapacity };
+    std::array<Event, kCapacity> events;
+};
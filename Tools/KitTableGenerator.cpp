@@ -0,0 +1,346 @@
+// Build-time tool: compiles the drum kit data file into DrumKitTables.h,
+// the constexpr tables behind DrumKitLibrary.
+//
+// Usage: KitTableGenerator <DrumKits.txt> <DrumKitTables.h>
+
+#include "KitIdHash.h"
+#include <algorithm>
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+#include <set>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace
+{
+    struct Pad
+    {
+        int midiNote;
+        std::string name, trigger;
+    };
+
+    struct Kit
+    {
+        std::string id, name, manufacturer;
+        int columns;
+        std::vector<Pad> pads;
+    };
+
+    struct Manufacturer
+    {
+        std::string name;
+        std::vector<size_t> kits;
+    };
+
+    std::string trim (const std::string& s)
+    {
+        auto start = s.find_first_not_of (" \t\r");
+        if (start == std::string::npos)
+            return {};
+
+        auto end = s.find_last_not_of (" \t\r");
+        return s.substr (start, end - start + 1);
+    }
+
+    std::vector<std::string> splitFields (const std::string& s)
+    {
+        std::vector<std::string> fields;
+        std::stringstream stream (s);
+
+        for (std::string field; std::getline (stream, field, '|');)
+            fields.push_back (trim (field));
+
+        return fields;
+    }
+
+    bool parseInt (const std::string& s, int& result)
+    {
+        if (s.empty() || s.find_first_not_of ("0123456789") != std::string::npos || s.size() > 4)
+            return false;
+
+        result = std::stoi (s);
+        return true;
+    }
+
+    std::string quote (const std::string& s)
+    {
+        std::string result = "\"";
+
+        for (char c : s)
+        {
+            if (c == '"' || c == '\\')
+                result += '\\';
+            result += c;
+        }
+
+        return result + "\"";
+    }
+
+    bool parse (const std::string& path, std::vector<Kit>& kits, std::string& error)
+    {
+        std::ifstream in (path);
+        if (! in)
+        {
+            error = path + ": cannot open";
+            return false;
+        }
+
+        std::set<std::string> ids;
+        int lineNumber = 0;
+
+        for (std::string line; std::getline (in, line);)
+        {
+            ++lineNumber;
+            auto fail = [&] (const std::string& message)
+            {
+                error = path + ":" + std::to_string (lineNumber) + ": " + message;
+                return false;
+            };
+
+            line = trim (line);
+            if (line.empty() || line[0] == '#')
+                continue;
+
+            for (unsigned char c : line)
+                if (c > 127)
+                    return fail ("only ASCII is supported");
+
+            if (line.compare (0, 4, "kit ") == 0)
+            {
+                auto fields = splitFields (line.substr (4));
+                Kit kit;
+
+                if (fields.size() != 4 || fields[0].empty() || fields[1].empty() || fields[2].empty())
+                    return fail ("expected: kit <id> | <name> | <manufacturer> | <columns>");
+
+                if (! parseInt (fields[3], kit.columns) || kit.columns < 1)
+                    return fail ("bad column count '" + fields[3] + "'");
+
+                if (! ids.insert (fields[0]).second)
+                    return fail ("duplicate kit id '" + fields[0] + "'");
+
+                kit.id = fields[0];
+                kit.name = fields[1];
+                kit.manufacturer = fields[2];
+                kits.push_back (std::move (kit));
+                continue;
+            }
+
+            if (kits.empty())
+                return fail ("pad outside of a kit");
+
+            auto fields = splitFields (line);
+            Pad pad;
+
+            if (fields.size() != 3 || fields[1].empty())
+                return fail ("expected: <midi note> | <pad> | <trigger>");
+
+            if (! parseInt (fields[0], pad.midiNote) || pad.midiNote > 127)
+                return fail ("bad MIDI note '" + fields[0] + "'");
+
+            pad.name = fields[1];
+            pad.trigger = fields[2];
+            kits.back().pads.push_back (std::move (pad));
+        }
+
+        if (kits.empty())
+        {
+            error = path + ": no kits";
+            return false;
+        }
+
+        return true;
+    }
+
+    struct HashTable
+    {
+        std::vector<std::uint32_t> bucketSeeds;
+        std::vector<int> slots;     // kit index, -1 if unused
+    };
+
+    // Hash and displace: the fullest buckets are placed first, each with the
+    // first seed that puts all of its ids in free slots.
+    bool buildHashTable (const std::vector<Kit>& kits, HashTable& table)
+    {
+        size_t numBuckets = 4, numSlots = 8;
+        while (numBuckets < kits.size() / 2)
+            numBuckets *= 2;
+        while (numSlots < kits.size() * 2)
+            numSlots *= 2;
+
+        std::vector<std::vector<size_t>> buckets (numBuckets);
+        for (size_t i = 0; i < kits.size(); ++i)
+            buckets[KitIdHash::hash (kits[i].id, 0) % numBuckets].push_back (i);
+
+        std::vector<size_t> order (numBuckets);
+        for (size_t i = 0; i < numBuckets; ++i)
+            order[i] = i;
+
+        std::stable_sort (order.begin(), order.end(),
+                          [&] (size_t a, size_t b) { return buckets[a].size() > buckets[b].size(); });
+
+        table.bucketSeeds.assign (numBuckets, 0);
+        table.slots.assign (numSlots, -1);
+
+        for (auto b : order)
+        {
+            if (buckets[b].empty())
+                break;
+
+            bool placed = false;
+
+            for (std::uint32_t seed = 1; seed < 1000000 && ! placed; ++seed)
+            {
+                std::vector<size_t> taken;
+
+                for (auto index : buckets[b])
+                {
+                    auto slot = KitIdHash::hash (kits[index].id, seed) % numSlots;
+                    if (table.slots[slot] != -1 || std::find (taken.begin(), taken.end(), slot) != taken.end())
+                        break;
+                    taken.push_back (slot);
+                }
+
+                if (taken.size() == buckets[b].size())
+                {
+                    for (size_t i = 0; i < taken.size(); ++i)
+                        table.slots[taken[i]] = (int) buckets[b][i];
+
+                    table.bucketSeeds[b] = seed;
+                    placed = true;
+                }
+            }
+
+            if (! placed)
+                return false;
+        }
+
+        return true;
+    }
+
+    std::string generate (const std::vector<Kit>& kits, const HashTable& table)
+    {
+        std::vector<Manufacturer> manufacturers;
+
+        for (size_t i = 0; i < kits.size(); ++i)
+        {
+            auto it = manufacturers.begin();
+            while (it != manufacturers.end() && it->name != kits[i].manufacturer)
+                ++it;
+
+            if (it == manufacturers.end())
+                it = manufacturers.insert (it, { kits[i].manufacturer, {} });
+
+            it->kits.push_back (i);
+        }
+
+        std::ostringstream out;
+        out << "// Generated by KitTableGenerator from DrumKits.txt. Do not edit.\n"
+               "#pragma once\n"
+               "\n"
+               "namespace DrumKitTables\n"
+               "{\n";
+
+        out << "inline constexpr PadInfo pads[] = {\n";
+        for (auto& kit : kits)
+            for (auto& pad : kit.pads)
+                out << "    { " << pad.midiNote << ", " << quote (pad.name) << ", " << quote (pad.trigger) << " },\n";
+        out << "};\n\n";
+
+        out << "inline constexpr DrumKitDefinition kits[] = {\n";
+        size_t firstPad = 0;
+        for (auto& kit : kits)
+        {
+            out << "    { " << quote (kit.id) << ", " << quote (kit.name) << ", " << quote (kit.manufacturer)
+                << ", std::span<const PadInfo> (pads + " << firstPad << ", " << kit.pads.size() << "), "
+                << kit.columns << " },\n";
+            firstPad += kit.pads.size();
+        }
+        out << "};\n\n";
+
+        out << "inline constexpr const DrumKitDefinition* kitsByManufacturer[] = {\n";
+        for (auto& mfr : manufacturers)
+            for (auto index : mfr.kits)
+                out << "    kits + " << index << ",\n";
+        out << "};\n\n";
+
+        out << "inline constexpr DrumKitManufacturer manufacturers[] = {\n";
+        size_t firstKit = 0;
+        for (auto& mfr : manufacturers)
+        {
+            out << "    { " << quote (mfr.name) << ", std::span<const DrumKitDefinition* const> (kitsByManufacturer + "
+                << firstKit << ", " << mfr.kits.size() << ") },\n";
+            firstKit += mfr.kits.size();
+        }
+        out << "};\n\n";
+
+        out << "// Perfect hash on kit id, see KitIdHash.h. idSlots holds indices into kits, -1 if unused.\n"
+            << "inline constexpr std::uint32_t idBucketSeeds[" << table.bucketSeeds.size() << "] = {";
+        for (size_t i = 0; i < table.bucketSeeds.size(); ++i)
+            out << (i % 16 == 0 ? "\n    " : " ") << table.bucketSeeds[i] << ",";
+        out << "\n};\n\n"
+            << "inline constexpr std::int16_t idSlots[" << table.slots.size() << "] = {";
+        for (size_t i = 0; i < table.slots.size(); ++i)
+            out << (i % 16 == 0 ? "\n    " : " ") << table.slots[i] << ",";
+        out << "\n};\n"
+               "}\n";
+
+        return out.str();
+    }
+}
+
+int main (int argc, char* argv[])
+{
+    if (argc != 3)
+    {
+        std::cerr << "usage: KitTableGenerator <DrumKits.txt> <DrumKitTables.h>\n";
+        return 1;
+    }
+
+    std::vector<Kit> kits;
+    std::string error;
+
+    if (! parse (argv[1], kits, error))
+    {
+        std::cerr << error << "\n";
+        return 1;
+    }
+
+    if (kits.size() > 16384)
+    {
+        std::cerr << argv[1] << ": too many kits\n";
+        return 1;
+    }
+
+    HashTable table;
+    if (! buildHashTable (kits, table))
+    {
+        std::cerr << argv[1] << ": no perfect hash found\n";
+        return 1;
+    }
+
+    auto generated = generate (kits, table);
+
+    // Leave an unchanged header alone so dependants don't rebuild
+    {
+        std::ifstream existing (argv[2], std::ios::binary);
+        std::ostringstream contents;
+        contents << existing.rdbuf();
+
+        if (existing && contents.str() == generated)
+            return 0;
+    }
+
+    std::ofstream out (argv[2], std::ios::binary);
+    out << generated;
+
+    if (! out)
+    {
+        std::cerr << argv[2] << ": cannot write\n";
+        return 1;
+    }
+
+    return 0;
+}